@@ -0,0 +1,348 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "TrackedAlloc.h"
+
+/**
+ * A B+ Tree with the same duplicate counting semantics as the Tree in
+ * Tree.c. Keys and counts are stored inline in wide nodes that span a few
+ * cache lines, so a lookup touches one node per level instead of one
+ * Node and one NodeData per key compared.
+ * It has the createTree, insert, find and destroyTree functions of Tree.c,
+ * so it can replace it, except that find returns the count of the key,
+ * since keys live inside the leaves and there is no Node to return.
+ * @author Pasindu Ravimal
+ * @date 10/18/2026
+ * @version 1.0.0
+*/
+typedef int TreeData;
+
+#define BTREE_NODE_SIZE 256
+#define BTREE_LEAF_KEYS 30
+#define BTREE_INNER_KEYS 20
+#define BTREE_MAX_LEVELS 32
+
+typedef struct _bTreeLeaf BTreeLeaf;
+
+/* Leaves hold the keys with their counts and are chained in key order. */
+typedef struct _bTreeLeaf{
+    int nKeys;
+    TreeData keys[BTREE_LEAF_KEYS];
+    int counts[BTREE_LEAF_KEYS];
+    BTreeLeaf* pNext;
+} BTreeLeaf;
+
+/* Child i of an inner node holds the keys k with keys[i-1] <= k < keys[i]. */
+typedef struct{
+    int nKeys;
+    TreeData keys[BTREE_INNER_KEYS];
+    void* children[BTREE_INNER_KEYS + 1];
+} BTreeInner;
+
+_Static_assert(sizeof(BTreeLeaf) <= BTREE_NODE_SIZE, "B+ Tree leaf is too wide");
+_Static_assert(sizeof(BTreeInner) <= BTREE_NODE_SIZE, "B+ Tree inner node is too wide");
+
+typedef struct{
+    void* root;
+    int height;
+    int size;
+} Tree;
+
+/* Prototypes:
+Tree* createTree();
+int getHeight(Tree* pTree);
+int getSize(Tree* pTree);
+void insert(TreeData* pData, Tree* pTree);
+int find(TreeData* pData, Tree* pTree);
+void destroyTree(Tree* pTree);
+*/
+
+/**
+ * Allocates a zeroed, cache line aligned block for a B+ Tree node and
+ * exits with a message to the stderr when no memory is available.
+ * 
+ * @return A pointer to the new block.
+*/
+void* allocBTreeNode(void){
+    void* pNode = trackedAlignedAlloc(64, BTREE_NODE_SIZE);
+    if (pNode == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        exit(EXIT_FAILURE);
+    }
+    memset(pNode, 0, BTREE_NODE_SIZE);
+    return pNode;
+}
+
+/**
+ * Creates a new instance of a B+ Tree structure.
+ * 
+ * @return A pointer to the new B+ Tree.
+*/
+Tree* createTree(){
+    Tree* temp = (Tree*) trackedCalloc(1, sizeof(Tree));
+    if (temp == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        exit(EXIT_FAILURE);
+    }
+    return temp;
+}
+
+/**
+ * Gets the number of levels in the B+ Tree. An empty Tree has height 0.
+ * 
+ * @return The height of the B+ Tree.
+*/
+int getHeight(Tree* pTree){
+    return pTree->height;
+}
+
+/**
+ * Gets the number of distinct keys stored in the B+ Tree.
+ * 
+ * @return The number of distinct keys.
+*/
+int getSize(Tree* pTree){
+    return pTree->size;
+}
+
+/**
+ * Finds the first key in a sorted array that is greater than the given
+ * key. The search is branch free, so it does not stall on mispredictions.
+ * 
+ * @param pKeys The sorted keys of a node.
+ * @param n The number of keys.
+ * @param key The key to search for.
+ * @return The index of the first greater key, or n if there is none.
+*/
+int upperBoundKeys(const TreeData* pKeys, int n, TreeData key){
+    const TreeData* pBase = pKeys;
+    while (n > 1){
+        int half = n / 2;
+        pBase = (pBase[half] <= key) ? pBase + half : pBase;
+        n -= half;
+    }
+    return (int) (pBase - pKeys) + (n == 1 && *pBase <= key);
+}
+
+/**
+ * Inserts a separator key and the node to its right into an inner node,
+ * splitting the inner node when it is full.
+ * 
+ * @param pInner The inner node to insert into.
+ * @param pos The position of the new separator key.
+ * @param key The separator key.
+ * @param pChild The node to the right of the separator key.
+ * @param pUpKey Set to the key moved up to the parent on a split.
+ * @return The new right sibling on a split, otherwise NULL.
+*/
+BTreeInner* insertInner(BTreeInner* pInner, int pos, TreeData key, void* pChild,
+                        TreeData* pUpKey){
+    TreeData keys[BTREE_INNER_KEYS + 1];
+    void* children[BTREE_INNER_KEYS + 2];
+    int n = pInner->nKeys;
+
+    if (n < BTREE_INNER_KEYS){
+        memmove(&pInner->keys[pos + 1], &pInner->keys[pos], (n - pos) * sizeof(TreeData));
+        memmove(&pInner->children[pos + 2], &pInner->children[pos + 1],
+                (n - pos) * sizeof(void*));
+        pInner->keys[pos] = key;
+        pInner->children[pos + 1] = pChild;
+        pInner->nKeys++;
+        return NULL;
+    }
+
+    memcpy(keys, pInner->keys, pos * sizeof(TreeData));
+    keys[pos] = key;
+    memcpy(&keys[pos + 1], &pInner->keys[pos], (n - pos) * sizeof(TreeData));
+    memcpy(children, pInner->children, (pos + 1) * sizeof(void*));
+    children[pos + 1] = pChild;
+    memcpy(&children[pos + 2], &pInner->children[pos + 1], (n - pos) * sizeof(void*));
+
+    BTreeInner* pRight = (BTreeInner*) allocBTreeNode();
+    int left = (n + 1) / 2;
+    int right = n - left;
+
+    pInner->nKeys = left;
+    memcpy(pInner->keys, keys, left * sizeof(TreeData));
+    memcpy(pInner->children, children, (left + 1) * sizeof(void*));
+
+    *pUpKey = keys[left];
+
+    pRight->nKeys = right;
+    memcpy(pRight->keys, &keys[left + 1], right * sizeof(TreeData));
+    memcpy(pRight->children, &children[left + 1], (right + 1) * sizeof(void*));
+    return pRight;
+}
+
+/**
+ * Inserts a new key into a leaf at the given position, splitting the leaf
+ * when it is full.
+ * 
+ * @param pLeaf The leaf to insert into.
+ * @param pos The position of the new key.
+ * @param key The key to insert.
+ * @return The new right sibling on a split, otherwise NULL.
+*/
+BTreeLeaf* insertLeaf(BTreeLeaf* pLeaf, int pos, TreeData key){
+    int n = pLeaf->nKeys;
+
+    if (n == BTREE_LEAF_KEYS){
+        BTreeLeaf* pRight = (BTreeLeaf*) allocBTreeNode();
+        int left = (n + 1) / 2;
+
+        pRight->nKeys = n - left;
+        memcpy(pRight->keys, &pLeaf->keys[left], (n - left) * sizeof(TreeData));
+        memcpy(pRight->counts, &pLeaf->counts[left], (n - left) * sizeof(int));
+        pRight->pNext = pLeaf->pNext;
+        pLeaf->pNext = pRight;
+        pLeaf->nKeys = left;
+
+        if (pos > left)
+            insertLeaf(pRight, pos - left, key);
+        else
+            insertLeaf(pLeaf, pos, key);
+        return pRight;
+    }
+
+    memmove(&pLeaf->keys[pos + 1], &pLeaf->keys[pos], (n - pos) * sizeof(TreeData));
+    memmove(&pLeaf->counts[pos + 1], &pLeaf->counts[pos], (n - pos) * sizeof(int));
+    pLeaf->keys[pos] = key;
+    pLeaf->counts[pos] = 1;
+    pLeaf->nKeys++;
+    return NULL;
+}
+
+/**
+ * Insert data to the B+ Tree. If the key is already present its count is
+ * increased, otherwise it is added with a count of one. Full nodes are
+ * split on the way back up, so the Tree stays balanced.
+ * 
+ * @param pData A pointer to the data to be added to the B+ Tree.
+ * @param pTree A pointer to the B+ Tree which the data to be added.
+*/
+void insert(TreeData* pData, Tree* pTree){
+    TreeData key = *pData;
+    BTreeInner* path[BTREE_MAX_LEVELS];
+    int slots[BTREE_MAX_LEVELS];
+
+    if (pTree->root == NULL){
+        BTreeLeaf* pLeaf = (BTreeLeaf*) allocBTreeNode();
+        pLeaf->keys[0] = key;
+        pLeaf->counts[0] = 1;
+        pLeaf->nKeys = 1;
+        pTree->root = pLeaf;
+        pTree->height = 1;
+        pTree->size = 1;
+        return;
+    }
+
+    void* pNode = pTree->root;
+    for (int level = 0; level < pTree->height - 1; level++){
+        BTreeInner* pInner = (BTreeInner*) pNode;
+        int slot = upperBoundKeys(pInner->keys, pInner->nKeys, key);
+        path[level] = pInner;
+        slots[level] = slot;
+        pNode = pInner->children[slot];
+    }
+
+    BTreeLeaf* pLeaf = (BTreeLeaf*) pNode;
+    int pos = upperBoundKeys(pLeaf->keys, pLeaf->nKeys, key);
+    if (pos > 0 && pLeaf->keys[pos - 1] == key){
+        pLeaf->counts[pos - 1]++;
+        return;
+    }
+
+    pTree->size++;
+    void* pSplit = insertLeaf(pLeaf, pos, key);
+    if (pSplit == NULL)
+        return;
+
+    TreeData upKey = ((BTreeLeaf*) pSplit)->keys[0];
+    for (int level = pTree->height - 2; level >= 0 && pSplit != NULL; level--)
+        pSplit = insertInner(path[level], slots[level], upKey, pSplit, &upKey);
+
+    if (pSplit != NULL){
+        BTreeInner* pRoot = (BTreeInner*) allocBTreeNode();
+        pRoot->nKeys = 1;
+        pRoot->keys[0] = upKey;
+        pRoot->children[0] = pTree->root;
+        pRoot->children[1] = pSplit;
+        pTree->root = pRoot;
+        pTree->height++;
+    }
+}
+
+/**
+ * Looks up data in the B+ Tree.
+ * 
+ * @param pData A pointer to the data to look for.
+ * @param pTree A pointer to the B+ Tree to search.
+ * @return The number of times the data was inserted, or 0 if it is absent.
+*/
+int find(TreeData* pData, Tree* pTree){
+    TreeData key = *pData;
+    void* pNode = pTree->root;
+
+    if (pNode == NULL)
+        return 0;
+
+    for (int level = 0; level < pTree->height - 1; level++){
+        BTreeInner* pInner = (BTreeInner*) pNode;
+        pNode = pInner->children[upperBoundKeys(pInner->keys, pInner->nKeys, key)];
+    }
+
+    BTreeLeaf* pLeaf = (BTreeLeaf*) pNode;
+    int pos = upperBoundKeys(pLeaf->keys, pLeaf->nKeys, key);
+    return (pos > 0 && pLeaf->keys[pos - 1] == key) ? pLeaf->counts[pos - 1] : 0;
+}
+
+/**
+ * Deallocate a subtree of the B+ Tree.
+ * 
+ * @param pNode The root node of the subtree.
+ * @param levels The number of levels in the subtree.
+*/
+void destroyBTreeNode(void* pNode, int levels){
+    if (levels > 1){
+        BTreeInner* pInner = (BTreeInner*) pNode;
+        for (int i = 0; i <= pInner->nKeys; i++)
+            destroyBTreeNode(pInner->children[i], levels - 1);
+    }
+    trackedFree(pNode);
+}
+
+/**
+ * Deallocate the B+ Tree and every node in it.
+ * 
+ * @param pTree A pointer to the B+ Tree to be deallocated.
+*/
+void destroyTree(Tree* pTree){
+    if (pTree->root != NULL)
+        destroyBTreeNode(pTree->root, pTree->height);
+    trackedFree(pTree);
+}
+
+#ifndef BTREE_NO_MAIN
+int main(){
+    AllocStats before = getAllocStats();
+    Tree* tree = createTree();
+    int values[] = {5,3,6,6,4};
+    for (int i = 0; i < 5; i++)
+    {
+        insert(&(values[i]), tree);
+    }
+
+    for (int i = 3; i <= 7; i++)
+    {
+        printf("%d occurs %d time(s)\n", i, find(&i, tree));
+    }
+
+    destroyTree(tree);
+    if (!checkNoLeaks(stderr, "BTree demo", &before))
+        return EXIT_FAILURE;
+    return 0;
+}
+#endif
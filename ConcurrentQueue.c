@@ -0,0 +1,328 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "TrackedAlloc.h"
+
+/**
+ * A lock-free FIFO queue for passing work between producer and consumer
+ * threads, following Michael and Scott's "Simple, Fast, and Practical
+ * Non-Blocking and Blocking Concurrent Queue Algorithms". It replaces a
+ * LinkedList guarded by a mutex around insertNodetoBack and
+ * removeNodefromFront. Dequeued Nodes are reclaimed with hazard pointers,
+ * so a Node is never freed while another thread may still read it.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+typedef int ListData;
+typedef struct _QueueNode QueueNode;
+
+#define QUEUE_HAZARDS 2
+#define QUEUE_CACHE_LINE 64
+
+typedef struct _QueueNode {
+    _Atomic(QueueNode*) pNext;
+    ListData data;
+} QueueNode;
+
+/* Each thread publishes the Nodes it is reading and keeps the Nodes it
+   has unlinked until no other thread publishes them. */
+typedef struct {
+    _Alignas(QUEUE_CACHE_LINE) _Atomic(QueueNode*) hazards[QUEUE_HAZARDS];
+    QueueNode** pRetired;
+    int retiredCount;
+} HazardRecord;
+
+typedef struct {
+    _Alignas(QUEUE_CACHE_LINE) _Atomic(QueueNode*) pHead;
+    _Alignas(QUEUE_CACHE_LINE) _Atomic(QueueNode*) pTail;
+    _Alignas(QUEUE_CACHE_LINE) atomic_int threadCount;
+    int maxThreads;
+    int retireLimit;
+    HazardRecord* pRecords;
+} ConcurrentQueue;
+
+/* Prototypes:
+ConcurrentQueue* createConcurrentQueue(int maxThreads);
+int attachQueueThread(ConcurrentQueue* pQueue);
+void enqueue(ConcurrentQueue* pQueue, int thread, ListData data);
+bool dequeue(ConcurrentQueue* pQueue, int thread, ListData* pData);
+void destroyConcurrentQueue(ConcurrentQueue* pQueue);
+*/
+
+/**
+ * Allocates memory and exits with a message to the stderr when no memory
+ * is available.
+ * 
+ * @param size The number of bytes to allocate.
+ * @return A pointer to the allocated memory.
+*/
+void* allocQueueMemory(size_t size){
+    void* p = trackedAlignedAlloc(QUEUE_CACHE_LINE,
+                            (size + QUEUE_CACHE_LINE - 1) / QUEUE_CACHE_LINE * QUEUE_CACHE_LINE);
+    if (p == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+/**
+ * Creates a new QueueNode holding the given data.
+ * 
+ * @param data The data to be stored.
+ * @return A pointer to the new QueueNode.
+*/
+QueueNode* createQueueNode(ListData data){
+    QueueNode* pNode = (QueueNode*) trackedMalloc(sizeof(QueueNode));
+    if (pNode == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        exit(EXIT_FAILURE);
+    }
+    atomic_init(&pNode->pNext, NULL);
+    pNode->data = data;
+    return pNode;
+}
+
+/**
+ * Creates an empty ConcurrentQueue. The queue always holds a dummy Node,
+ * so the head and the tail never have to be updated together.
+ * 
+ * @param maxThreads The largest number of threads that will attach.
+ * @return A pointer to the new ConcurrentQueue.
+*/
+ConcurrentQueue* createConcurrentQueue(int maxThreads){
+    ConcurrentQueue* pQueue = (ConcurrentQueue*) allocQueueMemory(sizeof(ConcurrentQueue));
+    QueueNode* pDummy = createQueueNode(0);
+
+    atomic_init(&pQueue->pHead, pDummy);
+    atomic_init(&pQueue->pTail, pDummy);
+    atomic_init(&pQueue->threadCount, 0);
+    pQueue->maxThreads = maxThreads;
+    pQueue->retireLimit = 2 * QUEUE_HAZARDS * maxThreads + 16;
+    pQueue->pRecords = (HazardRecord*) allocQueueMemory(maxThreads * sizeof(HazardRecord));
+
+    for (int i = 0; i < maxThreads; i++){
+        HazardRecord* pRecord = &pQueue->pRecords[i];
+        for (int h = 0; h < QUEUE_HAZARDS; h++)
+            atomic_init(&pRecord->hazards[h], NULL);
+        pRecord->pRetired = (QueueNode**) trackedMalloc(pQueue->retireLimit * sizeof(QueueNode*));
+        if (pRecord->pRetired == NULL){
+            fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+            "\n--- No Memory Available --- \n");
+            exit(EXIT_FAILURE);
+        }
+        pRecord->retiredCount = 0;
+    }
+    return pQueue;
+}
+
+/**
+ * Registers the calling thread with the ConcurrentQueue. Every thread
+ * must attach once and pass the returned number to enqueue and dequeue.
+ * 
+ * @param pQueue A pointer to the ConcurrentQueue.
+ * @return The number of the thread, or -1 if maxThreads are attached.
+*/
+int attachQueueThread(ConcurrentQueue* pQueue){
+    int thread = atomic_fetch_add(&pQueue->threadCount, 1);
+    return thread < pQueue->maxThreads ? thread : -1;
+}
+
+/**
+ * Frees every retired Node that no thread currently publishes as a
+ * hazard, and keeps the rest for a later scan.
+ * 
+ * @param pQueue A pointer to the ConcurrentQueue.
+ * @param pRecord The hazard record of the calling thread.
+*/
+void scanRetired(ConcurrentQueue* pQueue, HazardRecord* pRecord){
+    int kept = 0;
+
+    for (int r = 0; r < pRecord->retiredCount; r++){
+        QueueNode* pNode = pRecord->pRetired[r];
+        bool hazardous = false;
+
+        for (int t = 0; t < pQueue->maxThreads && !hazardous; t++)
+            for (int h = 0; h < QUEUE_HAZARDS; h++)
+                if (atomic_load(&pQueue->pRecords[t].hazards[h]) == pNode){
+                    hazardous = true;
+                    break;
+                }
+
+        if (hazardous)
+            pRecord->pRetired[kept++] = pNode;
+        else
+            trackedFree(pNode);
+    }
+    pRecord->retiredCount = kept;
+}
+
+/**
+ * Adds data to the back of the ConcurrentQueue without taking a lock.
+ * 
+ * @param pQueue A pointer to the ConcurrentQueue.
+ * @param thread The number returned by attachQueueThread.
+ * @param data The data to be added.
+*/
+void enqueue(ConcurrentQueue* pQueue, int thread, ListData data){
+    HazardRecord* pRecord = &pQueue->pRecords[thread];
+    QueueNode* pNode = createQueueNode(data);
+
+    while (true){
+        QueueNode* pTail = atomic_load(&pQueue->pTail);
+        atomic_store(&pRecord->hazards[0], pTail);
+        if (pTail != atomic_load(&pQueue->pTail))
+            continue;
+
+        QueueNode* pNext = atomic_load(&pTail->pNext);
+        if (pTail != atomic_load(&pQueue->pTail))
+            continue;
+
+        if (pNext != NULL){
+            /* Another enqueue linked its Node but has not moved the tail yet. */
+            atomic_compare_exchange_weak(&pQueue->pTail, &pTail, pNext);
+            continue;
+        }
+
+        QueueNode* pExpected = NULL;
+        if (atomic_compare_exchange_weak(&pTail->pNext, &pExpected, pNode)){
+            atomic_compare_exchange_strong(&pQueue->pTail, &pTail, pNode);
+            break;
+        }
+    }
+    atomic_store(&pRecord->hazards[0], NULL);
+}
+
+/**
+ * Removes data from the front of the ConcurrentQueue without taking a
+ * lock.
+ * 
+ * @param pQueue A pointer to the ConcurrentQueue.
+ * @param thread The number returned by attachQueueThread.
+ * @param pData Set to the removed data.
+ * @return false if the queue was empty.
+*/
+bool dequeue(ConcurrentQueue* pQueue, int thread, ListData* pData){
+    HazardRecord* pRecord = &pQueue->pRecords[thread];
+    QueueNode* pHead;
+
+    while (true){
+        pHead = atomic_load(&pQueue->pHead);
+        atomic_store(&pRecord->hazards[0], pHead);
+        if (pHead != atomic_load(&pQueue->pHead))
+            continue;
+
+        QueueNode* pTail = atomic_load(&pQueue->pTail);
+        QueueNode* pNext = atomic_load(&pHead->pNext);
+        atomic_store(&pRecord->hazards[1], pNext);
+        if (pHead != atomic_load(&pQueue->pHead))
+            continue;
+
+        if (pNext == NULL){
+            atomic_store(&pRecord->hazards[0], NULL);
+            atomic_store(&pRecord->hazards[1], NULL);
+            return false;
+        }
+
+        if (pHead == pTail){
+            atomic_compare_exchange_weak(&pQueue->pTail, &pTail, pNext);
+            continue;
+        }
+
+        ListData data = pNext->data;
+        if (atomic_compare_exchange_weak(&pQueue->pHead, &pHead, pNext)){
+            *pData = data;
+            break;
+        }
+    }
+
+    atomic_store(&pRecord->hazards[0], NULL);
+    atomic_store(&pRecord->hazards[1], NULL);
+
+    /* The old dummy Node is unlinked, but a slower thread may still read it. */
+    pRecord->pRetired[pRecord->retiredCount++] = pHead;
+    if (pRecord->retiredCount == pQueue->retireLimit)
+        scanRetired(pQueue, pRecord);
+    return true;
+}
+
+/**
+ * Deallocate the ConcurrentQueue with every Node still in it. No thread
+ * may use the queue while it is destroyed.
+ * 
+ * @param pQueue A pointer to the ConcurrentQueue to be deallocated.
+*/
+void destroyConcurrentQueue(ConcurrentQueue* pQueue){
+    QueueNode* pNode = atomic_load(&pQueue->pHead);
+    while (pNode != NULL){
+        QueueNode* pNext = atomic_load(&pNode->pNext);
+        trackedFree(pNode);
+        pNode = pNext;
+    }
+
+    for (int t = 0; t < pQueue->maxThreads; t++){
+        HazardRecord* pRecord = &pQueue->pRecords[t];
+        for (int r = 0; r < pRecord->retiredCount; r++)
+            trackedFree(pRecord->pRetired[r]);
+        trackedFree(pRecord->pRetired);
+    }
+    trackedFree(pQueue->pRecords);
+    trackedFree(pQueue);
+}
+
+#ifndef CONCURRENTQUEUE_NO_MAIN
+#include <pthread.h>
+
+#define PRODUCERS 4
+#define CONSUMERS 4
+#define ITEMS_PER_PRODUCER 100000
+
+ConcurrentQueue* pShared;
+atomic_llong consumedSum;
+atomic_int consumedCount;
+
+void* produce(void* pArg){
+    int thread = attachQueueThread(pShared);
+    for (int i = 1; i <= ITEMS_PER_PRODUCER; i++)
+        enqueue(pShared, thread, i);
+    return pArg;
+}
+
+void* consume(void* pArg){
+    int thread = attachQueueThread(pShared);
+    ListData data;
+    while (atomic_load(&consumedCount) < PRODUCERS * ITEMS_PER_PRODUCER){
+        if (dequeue(pShared, thread, &data)){
+            atomic_fetch_add(&consumedSum, data);
+            atomic_fetch_add(&consumedCount, 1);
+        }
+    }
+    return pArg;
+}
+
+int main(){
+    AllocStats before = getAllocStats();
+    pthread_t threads[PRODUCERS + CONSUMERS];
+    pShared = createConcurrentQueue(PRODUCERS + CONSUMERS);
+
+    for (int i = 0; i < PRODUCERS; i++)
+        pthread_create(&threads[i], NULL, produce, NULL);
+    for (int i = 0; i < CONSUMERS; i++)
+        pthread_create(&threads[PRODUCERS + i], NULL, consume, NULL);
+    for (int i = 0; i < PRODUCERS + CONSUMERS; i++)
+        pthread_join(threads[i], NULL);
+
+    long long expected = (long long) PRODUCERS * ITEMS_PER_PRODUCER * (ITEMS_PER_PRODUCER + 1) / 2;
+    printf("Consumed %d items, sum %lld (expected %lld)\n",
+           atomic_load(&consumedCount), (long long) atomic_load(&consumedSum), expected);
+
+    destroyConcurrentQueue(pShared);
+    if (!checkNoLeaks(stderr, "ConcurrentQueue demo", &before))
+        return 1;
+    return atomic_load(&consumedSum) == expected ? 0 : 1;
+}
+#endif
@@ -0,0 +1,427 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "TrackedAlloc.h"
+
+/**
+ * A Doubly Linked List with the same API as the LinkedList in
+ * SinglyLinkedList.c. Every Node also links to its predecessor, so both
+ * ends of the list and any Node with a known address can be unlinked in
+ * constant time. This makes the list suitable as a deque or as the
+ * recency list of an LRU cache.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+typedef int ListData;
+typedef struct _Node ListNode;
+
+typedef struct _Node {
+    ListNode* pNext;
+    ListNode* pPrev;
+    ListData* pData;
+} ListNode;
+
+typedef struct{
+    ListNode* pFirstNode;
+    ListNode* pLastNode;
+    int nodeCount;
+} LinkedList;
+
+/* Prototypes:
+LinkedList* createLinkedList();
+bool isEmpty(LinkedList* pList);
+int getSize(LinkedList* pList);
+void setSize(LinkedList* pList, int size);
+void insertNodetoFront(LinkedList* pList, ListNode* pNode);
+void insertNodetoBack(LinkedList* pList, ListNode* pNode);
+ListNode* removeNodefromFront(LinkedList* pList);
+ListNode* removeNodefromBack(LinkedList* pList);
+ListNode* unlinkNode(LinkedList* pList, ListNode* pNode);
+ListNode* getNode(LinkedList* pList, int pos);
+ListNode* createNode(ListData* pData);
+ListNode* createListNode(LinkedList* pList, ListData data);
+ListNode* getFirstNode(LinkedList* pList);
+ListNode* getLastNode(LinkedList* pList);
+ListData* getData(ListNode* pNode);
+void setData(ListNode* pNode, ListData* pData);
+void setFirstNode(LinkedList* pList, ListNode* Node);
+void setLastNode(LinkedList* pList, ListNode* Node);
+void deleteNode(ListNode* pNode);
+void destroyLinkedList(LinkedList* pList);
+void printList(LinkedList* pList, void (*printData)(ListData* pData), bool dataFlag);
+void printNode(ListNode* pNode, void (*printData) (ListData* pData));
+void OutofStorage(void);
+*/
+
+/**
+ * This function only prints a message to the stderr.
+*/
+void OutofStorage(void){
+    fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+    "\n--- No Memory Available --- \n");
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * Creates an instance of a LinkedList.
+ * 
+ * @return A pointer to the new LinkedList instance.
+*/
+LinkedList* createLinkedList(){
+    LinkedList* pLL = (LinkedList*) trackedCalloc(1, sizeof(LinkedList));
+    if (pLL == NULL)
+        OutofStorage();
+    return pLL;
+}
+
+/**
+ * Gets the size of the given LinkedList.
+ * 
+ * @param pList A pointer to the LinkedList to get the size.
+ * @return The size of the LinkedList.
+*/
+int getSize(LinkedList* pList){
+    return pList->nodeCount;
+}
+
+/**
+ * Sets the size of the given LinkedList.
+ * 
+ * @param pList A pointer to the LinkedList to get the size.
+*/
+void setSize(LinkedList* pList, int size){
+    pList->nodeCount = size;
+}
+
+/**
+ * Checks whether a given LinkedList is empty.
+ * 
+ * @param pList A pointer to the LinkedList to be checked empty.
+ * @return true if the LinkedList is empty.
+*/
+bool isEmpty(LinkedList* pList){
+    return (getSize(pList) == 0);
+}
+
+/**
+ * Gets the first Node of the LinkedList.
+ * 
+ * @param pList A pointer to the LinkedList to get the first Node.
+ * @return A pointer to the first Node.
+*/
+ListNode* getFirstNode(LinkedList* pList){
+    return pList->pFirstNode;
+}
+
+/**
+ * Gets the last Node of the LinkedList.
+ * 
+ * @param pList A pointer to the LinkedList to get the last Node.
+ * @return A pointer to the last Node.
+*/
+ListNode* getLastNode(LinkedList* pList){
+    return pList->pLastNode;
+}
+
+/**
+ * Sets the first Node of the LinkedList. This function
+ * does not change the Node in any means.
+ * 
+ * @param pList A pointer to the LinkedList to set the first Node.
+ * @param pNode A pointer to the Node to be set as the first Node.
+*/
+void setFirstNode(LinkedList* pList, ListNode* pNode){
+    pList->pFirstNode = pNode;
+}
+
+/**
+ * Sets the last Node of the LinkedList. This function
+ * does not change the Node in any means.
+ * 
+ * @param pList A pointer to the LinkedList to set the last Node.
+ * @param pNode A pointer to the Node to be set as the last Node.
+*/
+void setLastNode(LinkedList* pList, ListNode* pNode){
+    pList->pLastNode = pNode;
+}
+
+/**
+ * Insert a new Node to the Front of the LinkedList. This function
+ * is guaranteed to return in constant time.
+ * 
+ * @param pList A pointer to the LinkedList to add the new Node.
+ * @param pNode A pointer to the Node to be added.
+*/
+void insertNodetoFront(LinkedList* pList, ListNode* pNode){
+    ListNode* pNext = getFirstNode(pList);
+    pNode->pPrev = NULL;
+    pNode->pNext = pNext;
+    if (pNext == NULL)
+        setLastNode(pList, pNode);
+    else
+        pNext->pPrev = pNode;
+    setFirstNode(pList, pNode);
+    pList->nodeCount++;
+}
+
+/**
+ * Insert a new Node to the Back of the LinkedList. This function
+ * is guaranteed to return in constant time.
+ * 
+ * @param pList A pointer to the LinkedList to add the new Node.
+ * @param pNode A pointer to the Node to be added.
+*/
+void insertNodetoBack(LinkedList* pList, ListNode* pNode){
+    ListNode* pPrev = getLastNode(pList);
+    pNode->pNext = NULL;
+    pNode->pPrev = pPrev;
+    if (pPrev == NULL)
+        setFirstNode(pList, pNode);
+    else
+        pPrev->pNext = pNode;
+    setLastNode(pList, pNode);
+    pList->nodeCount++;
+}
+
+/**
+ * Unlinks the given Node from the LinkedList and returns it. The Node
+ * must belong to the list. This function is guaranteed to return in
+ * constant time and does not deallocate the Node.
+ * 
+ * @param pList A pointer to the LinkedList that contains the Node.
+ * @param pNode A pointer to the Node to be unlinked.
+ * @return A pointer to the unlinked Node.
+*/
+ListNode* unlinkNode(LinkedList* pList, ListNode* pNode){
+    if (pNode->pPrev == NULL)
+        setFirstNode(pList, pNode->pNext);
+    else
+        pNode->pPrev->pNext = pNode->pNext;
+
+    if (pNode->pNext == NULL)
+        setLastNode(pList, pNode->pPrev);
+    else
+        pNode->pNext->pPrev = pNode->pPrev;
+
+    pNode->pNext = NULL;
+    pNode->pPrev = NULL;
+    pList->nodeCount--;
+    return pNode;
+}
+
+/**
+ * Removes the front Node from the LinkedList and returns it.
+ * This does not deallocate the memory that is allocated for the
+ * Node. In order to deallocate memory, use the deleteNode function
+ * on the returned Node.
+ * 
+ * @param pList A pointer to the LinkedList to unlink the front Node from.
+ * @return A pointer to the unlinked Node.
+*/
+ListNode* removeNodefromFront(LinkedList* pList){
+    if (isEmpty(pList))
+        return NULL;
+    return unlinkNode(pList, getFirstNode(pList));
+}
+
+/**
+ * Removes the last Node from the LinkedList and returns it. Unlike the
+ * singly linked version, this function is guaranteed to return in
+ * constant time. It does not deallocate the Node.
+ * 
+ * @param pList A pointer to the LinkedList to unlink the last Node from.
+ * @return A pointer to the unlinked Node.
+*/
+ListNode* removeNodefromBack(LinkedList* pList){
+    if (isEmpty(pList))
+        return NULL;
+    return unlinkNode(pList, getLastNode(pList));
+}
+
+/**
+ * Gets the Node at the given position. The list is walked from whichever
+ * end is closer to the position.
+ * 
+ * @param pList A pointer to the LinkedList to get the Node from.
+ * @param pos The position of the Node.
+ * @return A pointer to the Node at the given position.
+*/
+ListNode* getNode(LinkedList* pList, int pos){
+    if (isEmpty(pList))
+        return NULL;
+    if (pos <= 0)
+        return getFirstNode(pList);
+    if (pos >= getSize(pList) - 1)
+        return getLastNode(pList);
+
+    ListNode* pCurr;
+    if (pos < getSize(pList) / 2){
+        pCurr = getFirstNode(pList);
+        for (int i = 0; i < pos; i++)
+            pCurr = pCurr->pNext;
+    } else {
+        pCurr = getLastNode(pList);
+        for (int i = getSize(pList) - 1; i > pos; i--)
+            pCurr = pCurr->pPrev;
+    }
+    return pCurr;
+}
+
+/**
+ * Gets the data stored in the Node.
+ * 
+ * @param pNode A pointer to the Node containing data.
+ * @return A pointer to the data contained.
+*/
+ListData* getData(ListNode* pNode){
+    return pNode->pData;
+}
+
+/**
+ * Sets the data stored in the Node.
+ * 
+ * @param pNode A pointer to the Node to store data.
+ * @param pData A pointer to the data to be stored.
+*/
+void setData(ListNode* pNode, ListData* pData){
+    pNode->pData = pData;
+}
+
+/**
+ * Creates a new Node structure using the given data. deleteNode frees
+ * the data, so it must come from trackedMalloc or trackedCalloc.
+ * 
+ * @param pData A pointer to the data to be stored in the Node.
+ * @return A pointer to the created Node structure.
+*/
+ListNode* createNode(ListData* pData){
+    ListNode* pNewNode = (ListNode*) trackedCalloc(1, sizeof(ListNode));
+
+    if (pNewNode == NULL)
+        OutofStorage();
+    setData(pNewNode, pData);
+    return pNewNode;
+}
+
+/**
+ * Creates a new Node for the given LinkedList holding a copy of the data.
+ * 
+ * @param pList A pointer to the LinkedList the Node is created for.
+ * @param data The data to be stored in the Node.
+ * @return A pointer to the created Node.
+*/
+ListNode* createListNode(LinkedList* pList, ListData data){
+    ListData* pData = (ListData*) trackedMalloc(sizeof(ListData));
+    if (pData == NULL)
+        OutofStorage();
+    *pData = data;
+    return createNode(pData);
+}
+
+/**
+ * Deallocate both the data stored in the Node and the Node itself.
+ * 
+ * @param pNode A pointer to the Node to be deallocated.
+*/
+void deleteNode(ListNode* pNode){
+    trackedFree(getData(pNode));
+    trackedFree(pNode);
+}
+
+/**
+ * Deallocate the LinkedList and every Node in it.
+ * 
+ * @param pList A pointer to the LinkedList to be deallocated.
+*/
+void destroyLinkedList(LinkedList* pList){
+    ListNode* pCurr = getFirstNode(pList);
+    while (pCurr != NULL){
+        ListNode* pNext = pCurr->pNext;
+        deleteNode(pCurr);
+        pCurr = pNext;
+    }
+    trackedFree(pList);
+}
+
+/**
+ * Prints the contents of the Node.
+ * 
+ * @param pNode A pointer to the Node to be printed.
+ * @param printData The fuction to print the data.
+*/
+void printNode(ListNode* pNode, void (*printData)(ListData* pData)){
+    printData(getData(pNode));
+}
+
+/**
+ * Prints all the Nodes in the LinkedList and its contents to
+ * the stdout if dataFlag is true or only the Nodes if it is false.
+ * 
+ * @param pList A pointer to the LinkedList to be printed.
+ * @param printData The function to print the data.
+ * @param dataFlag Whether data in the Node should printed.
+*/
+void printList(LinkedList* pList, void (*printData)(ListData* pData), bool dataFlag){
+    fprintf(stdout, "List has %2d entries: [", getSize(pList));
+
+    ListNode* pCurr = getFirstNode(pList);
+    while((pCurr != NULL) && dataFlag){
+        printNode(pCurr, printData);
+        pCurr = pCurr->pNext;
+    }
+
+    fprintf(stdout, "]\n");
+}
+
+//----------------------------------------------------------
+//---------Specific to Testing------------------------------
+#ifndef DOUBLYLINKEDLIST_NO_MAIN
+
+#define CACHE_CAPACITY 3
+#define CACHE_KEYS 8
+
+void printInt(int* i){
+    printf("%2d ", *i);
+}
+
+/**
+ * Touches a key in a small LRU cache. The most recently used key is kept
+ * at the front, and the least recently used key is evicted from the back.
+ * 
+ * @param pLRU The recency list of the cache.
+ * @param index The Node of each cached key, or NULL if it is not cached.
+ * @param key The key being accessed.
+*/
+void touchKey(LinkedList* pLRU, ListNode* index[], int key){
+    if (index[key] != NULL){
+        insertNodetoFront(pLRU, unlinkNode(pLRU, index[key]));
+        printf("Hit  [%2d]  ", key);
+    } else {
+        if (getSize(pLRU) == CACHE_CAPACITY){
+            ListNode* pOld = removeNodefromBack(pLRU);
+            index[*getData(pOld)] = NULL;
+            deleteNode(pOld);
+        }
+        index[key] = createListNode(pLRU, key);
+        insertNodetoFront(pLRU, index[key]);
+        printf("Miss [%2d]  ", key);
+    }
+    printList(pLRU, printInt, true);
+}
+
+int main(){
+    AllocStats before = getAllocStats();
+    LinkedList* pLRU = createLinkedList();
+    ListNode* index[CACHE_KEYS] = {NULL};
+    int accesses[] = {1, 2, 3, 1, 4, 2, 5, 1};
+
+    for (int i = 0; i < 8; i++)
+        touchKey(pLRU, index, accesses[i]);
+
+    destroyLinkedList(pLRU);
+    if (!checkNoLeaks(stderr, "LRU demo", &before))
+        return EXIT_FAILURE;
+    return 0;
+}
+#endif
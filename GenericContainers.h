@@ -0,0 +1,260 @@
+/**
+ * Type specialised containers Header File
+ * 
+ * The macros in this file generate a singly linked list and a counting
+ * tree for one element type at a time. Elements are stored by value inside
+ * the Nodes, so a record costs one allocation, and the compare function
+ * of a tree is called directly, so the compiler can inline it.
+ * 
+ * Usage:
+ *      typedef struct { long id; double x, y; } Point;
+ *      static int comparePoint(const Point* a, const Point* b){
+ *          return (a->id > b->id) - (a->id < b->id);
+ *      }
+ *      DEFINE_LIST(PointList, Point)
+ *      DEFINE_TREE(PointTree, Point, comparePoint)
+ * 
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#ifndef GENERIC_CONTAINERS_H
+#define GENERIC_CONTAINERS_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "TrackedAlloc.h"
+
+/**
+ * Allocates zeroed memory and exits with a message to the stderr when no
+ * memory is available.
+ * 
+ * Parameters:
+ * size_t size                  The number of bytes to allocate.
+ * 
+ * Returns:
+ *      A pointer to the allocated memory.
+*/
+static inline void* genericAlloc(size_t size){
+    void* p = trackedCalloc(1, size);
+    if (p == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+/**
+ * Generates a singly linked list of T named Name, with the functions
+ * NameCreate, NameSize, NamePushFront, NamePushBack, NamePopFront,
+ * NameFirst, NameNext and NameDestroy.
+*/
+#define DEFINE_LIST(Name, T)                                                \
+typedef struct Name##Node Name##Node;                                       \
+                                                                            \
+struct Name##Node{                                                          \
+    Name##Node* next;                                                       \
+    T data;                                                                 \
+};                                                                          \
+                                                                            \
+typedef struct{                                                             \
+    Name##Node* head;                                                       \
+    Name##Node* tail;                                                       \
+    int nodeCount;                                                          \
+} Name;                                                                     \
+                                                                            \
+static inline Name* Name##Create(void){                                     \
+    return (Name*) genericAlloc(sizeof(Name));                              \
+}                                                                           \
+                                                                            \
+static inline int Name##Size(Name* list){                                   \
+    return list->nodeCount;                                                 \
+}                                                                           \
+                                                                            \
+static inline void Name##PushFront(Name* list, T value){                    \
+    Name##Node* node = (Name##Node*) genericAlloc(sizeof(Name##Node));      \
+    node->data = value;                                                     \
+    node->next = list->head;                                                \
+    if (list->head == NULL)                                                 \
+        list->tail = node;                                                  \
+    list->head = node;                                                      \
+    list->nodeCount++;                                                      \
+}                                                                           \
+                                                                            \
+static inline void Name##PushBack(Name* list, T value){                     \
+    Name##Node* node = (Name##Node*) genericAlloc(sizeof(Name##Node));      \
+    node->data = value;                                                     \
+    if (list->head == NULL)                                                 \
+        list->head = node;                                                  \
+    else                                                                    \
+        list->tail->next = node;                                            \
+    list->tail = node;                                                      \
+    list->nodeCount++;                                                      \
+}                                                                           \
+                                                                            \
+static inline bool Name##PopFront(Name* list, T* out){                      \
+    Name##Node* node = list->head;                                          \
+    if (node == NULL)                                                       \
+        return false;                                                       \
+    list->head = node->next;                                                \
+    if (list->head == NULL)                                                 \
+        list->tail = NULL;                                                  \
+    list->nodeCount--;                                                      \
+    if (out != NULL)                                                        \
+        *out = node->data;                                                  \
+    trackedFree(node);                                                      \
+    return true;                                                            \
+}                                                                           \
+                                                                            \
+static inline Name##Node* Name##First(Name* list){                          \
+    return list->head;                                                      \
+}                                                                           \
+                                                                            \
+static inline Name##Node* Name##Next(Name##Node* node){                     \
+    return node->next;                                                      \
+}                                                                           \
+                                                                            \
+static inline void Name##Destroy(Name* list){                               \
+    Name##Node* node = list->head;                                          \
+    while (node != NULL){                                                   \
+        Name##Node* next = node->next;                                      \
+        trackedFree(node);                                                  \
+        node = next;                                                        \
+    }                                                                       \
+    trackedFree(list);                                                      \
+}
+
+/**
+ * Generates a self-balancing (AVL) counting tree of T named Name. Equal
+ * elements, as decided by int Compare(const T*, const T*), share one Node
+ * and increase its count. The functions are NameCreate, NameSize,
+ * NameHeight, NameInsert, NameFind and NameDestroy.
+*/
+#define DEFINE_TREE(Name, T, Compare)                                       \
+typedef struct Name##Node Name##Node;                                       \
+                                                                            \
+struct Name##Node{                                                          \
+    Name##Node* left;                                                       \
+    Name##Node* right;                                                      \
+    int count;                                                              \
+    int height;                                                             \
+    T data;                                                                 \
+};                                                                          \
+                                                                            \
+typedef struct{                                                             \
+    Name##Node* root;                                                       \
+    int size;                                                               \
+} Name;                                                                     \
+                                                                            \
+static inline Name* Name##Create(void){                                     \
+    return (Name*) genericAlloc(sizeof(Name));                              \
+}                                                                           \
+                                                                            \
+static inline int Name##Size(Name* tree){                                   \
+    return tree->size;                                                      \
+}                                                                           \
+                                                                            \
+static inline int Name##NodeHeight(Name##Node* node){                       \
+    return node == NULL ? 0 : node->height;                                 \
+}                                                                           \
+                                                                            \
+static inline int Name##Height(Name* tree){                                 \
+    return Name##NodeHeight(tree->root);                                    \
+}                                                                           \
+                                                                            \
+static inline void Name##Update(Name##Node* node){                          \
+    int l = Name##NodeHeight(node->left);                                   \
+    int r = Name##NodeHeight(node->right);                                  \
+    node->height = (l > r ? l : r) + 1;                                     \
+}                                                                           \
+                                                                            \
+static inline Name##Node* Name##RotateLeft(Name##Node* node){               \
+    Name##Node* right = node->right;                                        \
+    node->right = right->left;                                              \
+    right->left = node;                                                     \
+    Name##Update(node);                                                     \
+    Name##Update(right);                                                    \
+    return right;                                                           \
+}                                                                           \
+                                                                            \
+static inline Name##Node* Name##RotateRight(Name##Node* node){              \
+    Name##Node* left = node->left;                                          \
+    node->left = left->right;                                               \
+    left->right = node;                                                     \
+    Name##Update(node);                                                     \
+    Name##Update(left);                                                     \
+    return left;                                                            \
+}                                                                           \
+                                                                            \
+static inline Name##Node* Name##Rebalance(Name##Node* node){                \
+    Name##Update(node);                                                     \
+    int balance = Name##NodeHeight(node->left)                              \
+                  - Name##NodeHeight(node->right);                          \
+    if (balance > 1){                                                       \
+        if (Name##NodeHeight(node->left->left)                              \
+            < Name##NodeHeight(node->left->right))                          \
+            node->left = Name##RotateLeft(node->left);                      \
+        return Name##RotateRight(node);                                     \
+    }                                                                       \
+    if (balance < -1){                                                      \
+        if (Name##NodeHeight(node->right->right)                            \
+            < Name##NodeHeight(node->right->left))                          \
+            node->right = Name##RotateRight(node->right);                   \
+        return Name##RotateLeft(node);                                      \
+    }                                                                       \
+    return node;                                                            \
+}                                                                           \
+                                                                            \
+static Name##Node* Name##InsertAt(Name* tree, Name##Node* node,             \
+                                  const T* value){                          \
+    if (node == NULL){                                                      \
+        node = (Name##Node*) genericAlloc(sizeof(Name##Node));              \
+        node->data = *value;                                                \
+        node->count = 1;                                                    \
+        node->height = 1;                                                   \
+        tree->size++;                                                       \
+        return node;                                                        \
+    }                                                                       \
+    int c = Compare(value, &node->data);                                    \
+    if (c == 0){                                                            \
+        node->count++;                                                      \
+        return node;                                                        \
+    }                                                                       \
+    if (c < 0)                                                              \
+        node->left = Name##InsertAt(tree, node->left, value);               \
+    else                                                                    \
+        node->right = Name##InsertAt(tree, node->right, value);             \
+    return Name##Rebalance(node);                                           \
+}                                                                           \
+                                                                            \
+static inline void Name##Insert(Name* tree, const T* value){                \
+    tree->root = Name##InsertAt(tree, tree->root, value);                   \
+}                                                                           \
+                                                                            \
+static inline Name##Node* Name##Find(Name* tree, const T* value){           \
+    Name##Node* node = tree->root;                                          \
+    while (node != NULL){                                                   \
+        int c = Compare(value, &node->data);                                \
+        if (c == 0)                                                         \
+            return node;                                                    \
+        node = c < 0 ? node->left : node->right;                            \
+    }                                                                       \
+    return NULL;                                                            \
+}                                                                           \
+                                                                            \
+static void Name##DestroyAt(Name##Node* node){                              \
+    if (node == NULL)                                                       \
+        return;                                                             \
+    Name##DestroyAt(node->left);                                            \
+    Name##DestroyAt(node->right);                                           \
+    trackedFree(node);                                                      \
+}                                                                           \
+                                                                            \
+static inline void Name##Destroy(Name* tree){                               \
+    Name##DestroyAt(tree->root);                                            \
+    trackedFree(tree);                                                      \
+}
+
+#endif
@@ -0,0 +1,255 @@
+/**
+ * Operation statistics Header File
+ *
+ * Counts the hot operations of the containers: how often each one runs,
+ * how many Nodes it walks, how often it hits, and how long it takes. A
+ * degenerate shape, such as a Tree that grew into a list or a list that
+ * is walked from the front on every lookup, shows up as a large average
+ * or maximum walk long before it becomes an outage.
+ *
+ * The statistics are compiled in with -DCOLLECT_STATS. Without it the
+ * STATS_ macros expand to nothing, so the operations cost the same as
+ * before, getStats returns zeros and dumpStats only prints a note.
+ *
+ * Walks and latencies are kept in histograms with power of two buckets.
+ * Bucket 0 counts the value 0, and bucket i counts the values from
+ * 2^(i-1) up to 2^i - 1.
+ *
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#ifndef OPERATION_STATS_H
+#define OPERATION_STATS_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#define STATS_BUCKETS 40
+
+/* The operations that are counted. What a hit means depends on the
+   operation: a duplicate for Tree insert, a found key for Tree find and
+   erase, a list of one Node for removeNodefromBack, and a walk that used
+   the position index for the other LinkedList operations. */
+typedef enum{
+    eStatsTreeInsert,
+    eStatsTreeFind,
+    eStatsTreeErase,
+    eStatsListGetNode,
+    eStatsListRemoveBack,
+    eStatsListInsertAt,
+    eStatsListRemoveAt,
+    STATS_OPERATIONS
+} eStatsOperation;
+
+typedef struct{
+    long long calls;
+    long long hits;
+    long long steps;
+    long long maxSteps;
+    long long stepBuckets[STATS_BUCKETS];
+    long long latencyBuckets[STATS_BUCKETS];
+} OperationStats;
+
+#ifdef COLLECT_STATS
+#include <stdatomic.h>
+#include <time.h>
+
+static const char* const statsNames[STATS_OPERATIONS] = {
+    "Tree insert", "Tree find", "Tree erase",
+    "LinkedList getNode", "LinkedList removeNodefromBack",
+    "LinkedList insertNodeAt", "LinkedList removeNodeAt"
+};
+
+static const char* const statsHitNames[STATS_OPERATIONS] = {
+    "duplicates", "found", "found",
+    "indexed", "single Node", "indexed", "indexed"
+};
+
+typedef struct{
+    atomic_llong calls;
+    atomic_llong hits;
+    atomic_llong steps;
+    atomic_llong maxSteps;
+    atomic_llong stepBuckets[STATS_BUCKETS];
+    atomic_llong latencyBuckets[STATS_BUCKETS];
+} StatsCounters;
+
+static StatsCounters statsCounters[STATS_OPERATIONS];
+
+/**
+ * Gets the time of a monotonic clock.
+ *
+ * @return The time in nanoseconds.
+*/
+static inline long long statsNow(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * Gets the histogram bucket of a value.
+ *
+ * @param value A value of at least 0.
+ * @return The number of bits needed for the value, at most STATS_BUCKETS - 1.
+*/
+static inline int statsBucket(long long value){
+    int bucket = value > 0 ? 64 - __builtin_clzll((unsigned long long) value) : 0;
+    return bucket < STATS_BUCKETS ? bucket : STATS_BUCKETS - 1;
+}
+
+/**
+ * Counts one run of an operation. The counters are updated with relaxed
+ * atomics, so operations running on several threads are all counted.
+ *
+ * @param op The operation.
+ * @param start The time the operation started, from statsNow.
+ * @param steps The number of Nodes the operation walked.
+ * @param hit Whether the operation hit, see eStatsOperation.
+*/
+static inline void recordOperation(eStatsOperation op, long long start, long long steps, bool hit){
+    StatsCounters* pCounters = &statsCounters[op];
+    long long elapsed = statsNow() - start;
+
+    atomic_fetch_add_explicit(&pCounters->calls, 1, memory_order_relaxed);
+    if (hit)
+        atomic_fetch_add_explicit(&pCounters->hits, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&pCounters->steps, steps, memory_order_relaxed);
+    long long max = atomic_load_explicit(&pCounters->maxSteps, memory_order_relaxed);
+    while (steps > max && !atomic_compare_exchange_weak_explicit(&pCounters->maxSteps, &max, steps,
+                                                                 memory_order_relaxed,
+                                                                 memory_order_relaxed))
+        ;
+    atomic_fetch_add_explicit(&pCounters->stepBuckets[statsBucket(steps)], 1,
+                              memory_order_relaxed);
+    atomic_fetch_add_explicit(&pCounters->latencyBuckets[statsBucket(elapsed)], 1,
+                              memory_order_relaxed);
+}
+
+/* Declares a variable holding the start time of an operation. */
+#define STATS_START(start) long long start = statsNow()
+/* Adds n to a local walk counter. */
+#define STATS_STEP(steps, n) ((steps) += (n))
+/* Counts the operation that started at start. */
+#define STATS_RECORD(op, start, steps, hit) recordOperation(op, start, steps, hit)
+
+/**
+ * Gets a snapshot of the statistics of one operation.
+ *
+ * @param op The operation.
+ * @return The statistics.
+*/
+static inline OperationStats getStats(eStatsOperation op){
+    StatsCounters* pCounters = &statsCounters[op];
+    OperationStats stats;
+
+    stats.calls = atomic_load(&pCounters->calls);
+    stats.hits = atomic_load(&pCounters->hits);
+    stats.steps = atomic_load(&pCounters->steps);
+    stats.maxSteps = atomic_load(&pCounters->maxSteps);
+    for (int i = 0; i < STATS_BUCKETS; i++){
+        stats.stepBuckets[i] = atomic_load(&pCounters->stepBuckets[i]);
+        stats.latencyBuckets[i] = atomic_load(&pCounters->latencyBuckets[i]);
+    }
+    return stats;
+}
+
+/**
+ * Sets the statistics of every operation back to zero. No operation may
+ * run at the same time.
+*/
+static inline void resetStats(void){
+    for (int op = 0; op < STATS_OPERATIONS; op++){
+        StatsCounters* pCounters = &statsCounters[op];
+        atomic_store(&pCounters->calls, 0);
+        atomic_store(&pCounters->hits, 0);
+        atomic_store(&pCounters->steps, 0);
+        atomic_store(&pCounters->maxSteps, 0);
+        for (int i = 0; i < STATS_BUCKETS; i++){
+            atomic_store(&pCounters->stepBuckets[i], 0);
+            atomic_store(&pCounters->latencyBuckets[i], 0);
+        }
+    }
+}
+
+/**
+ * Gets the upper end of the bucket that holds the given fraction of the
+ * counted values.
+ *
+ * @param pBuckets The histogram.
+ * @param total The number of counted values.
+ * @param fraction The fraction, between 0 and 1.
+ * @return The largest value the bucket can hold.
+*/
+static inline long long statsPercentile(const long long* pBuckets, long long total,
+                                        double fraction){
+    long long seen = 0;
+    for (int i = 0; i < STATS_BUCKETS; i++){
+        seen += pBuckets[i];
+        if (seen > 0 && seen >= fraction * total)
+            return i == 0 ? 0 : (1LL << i) - 1;
+    }
+    return (1LL << (STATS_BUCKETS - 1)) - 1;
+}
+
+/**
+ * Prints one histogram on a single line, skipping empty buckets.
+ *
+ * @param pFile The stream to print to.
+ * @param pLabel The name of the histogram.
+ * @param pBuckets The histogram.
+*/
+static inline void printStatsHistogram(FILE* pFile, const char* pLabel, const long long* pBuckets){
+    fprintf(pFile, "    %-8s", pLabel);
+    for (int i = 0; i < STATS_BUCKETS; i++)
+        if (pBuckets[i] > 0)
+            fprintf(pFile, " <%lld:%lld", 1LL << i, pBuckets[i]);
+    fprintf(pFile, "\n");
+}
+
+/**
+ * Prints the statistics of every operation that ran: the number of calls,
+ * the hit rate, the average and longest walk, the median and 99th
+ * percentile of the walks and latencies, and both histograms.
+ *
+ * @param pFile The stream to print to.
+*/
+static inline void dumpStats(FILE* pFile){
+    for (int op = 0; op < STATS_OPERATIONS; op++){
+        OperationStats stats = getStats(op);
+        if (stats.calls == 0)
+            continue;
+
+        fprintf(pFile, "%s: %lld calls, %.1f%% %s, walk avg %.2f max %lld p50 <=%lld p99 <=%lld,"
+                " latency p50 <=%lld ns p99 <=%lld ns\n",
+                statsNames[op], stats.calls, 100.0 * stats.hits / stats.calls, statsHitNames[op],
+                (double) stats.steps / stats.calls, stats.maxSteps,
+                statsPercentile(stats.stepBuckets, stats.calls, 0.5),
+                statsPercentile(stats.stepBuckets, stats.calls, 0.99),
+                statsPercentile(stats.latencyBuckets, stats.calls, 0.5),
+                statsPercentile(stats.latencyBuckets, stats.calls, 0.99));
+        printStatsHistogram(pFile, "walk", stats.stepBuckets);
+        printStatsHistogram(pFile, "ns", stats.latencyBuckets);
+    }
+}
+
+#else
+#define STATS_START(start)
+#define STATS_STEP(steps, n) ((void) (steps))
+#define STATS_RECORD(op, start, steps, hit) ((void) 0)
+
+static inline OperationStats getStats(eStatsOperation op){
+    OperationStats stats = {0};
+    return stats;
+}
+
+static inline void resetStats(void){
+}
+
+static inline void dumpStats(FILE* pFile){
+    fprintf(pFile, "Operation statistics are off, build with -DCOLLECT_STATS\n");
+}
+#endif
+
+#endif
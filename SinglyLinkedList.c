@@ -1,6 +1,16 @@
+#define _POSIX_C_SOURCE 200809L
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "TrackedAlloc.h"
+#include "OperationStats.h"
 
 /**
  * A concrete Singly Linked List structure based on Jeff Szuhay's
@@ -11,18 +21,127 @@
 */
 typedef int ListData;
 typedef struct _Node ListNode;
+typedef struct _NodePool NodePool;
+typedef struct _ListIndex ListIndex;
 
 typedef struct _Node {
     ListNode* pNext;
     ListData* pData;
+    NodePool* pPool;
 } ListNode;
 
+/* A pooled Node and its data share one slot of a chunk. */
+typedef struct {
+    ListNode node;
+    ListData data;
+} PoolSlot;
+
+typedef struct _PoolChunk PoolChunk;
+
+typedef struct _PoolChunk {
+    PoolChunk* pNext;
+    PoolSlot slots[];
+} PoolChunk;
+
+typedef struct _NodePool {
+    PoolChunk* pChunks;
+    ListNode* pFreeNodes;
+    int usedSlots;
+    int chunkSize;
+    int refCount;
+} NodePool;
+
 typedef struct{
     ListNode* pFirstNode;
     ListNode* pLastNode;
     int nodeCount;
+    NodePool* pPool;
+    ListIndex* pIndex;
 } LinkedList;
 
+#define POOL_CHUNK_SIZE 1024
+#define LIST_INDEX_LEVELS 16
+
+/* The position index of a LinkedList is a skip list laid over its Nodes.
+   A tower stands on one Node, and each of its links skips span Nodes to
+   the next tower of the same level. */
+typedef struct _IndexTower IndexTower;
+
+typedef struct{
+    IndexTower* pNext;
+    int span;
+} IndexLink;
+
+typedef struct _IndexTower {
+    ListNode* pNode;
+    int height;
+    IndexLink links[];
+} IndexTower;
+
+typedef struct _ListIndex {
+    IndexTower* pHead;
+    unsigned int seed;
+    bool stale;
+} ListIndex;
+
+#define MAPPED_LIST_VERSION 1
+
+/* The file written by saveLinkedList is a header followed by the data of
+   every Node in list order. The successor of a Node is the next entry,
+   so the file holds no links at all and maps at any address. */
+typedef struct{
+    char magic[4];
+    uint32_t version;
+    uint32_t dataSize;
+    uint32_t nodeCount;
+} MappedListHeader;
+
+typedef struct{
+    void* pBase;
+    size_t size;
+    const MappedListHeader* pHeader;
+    const ListData* pData;
+} MappedList;
+
+/* A position in a LinkedList that steps forward in constant time. */
+typedef struct{
+    LinkedList* pList;
+    ListNode* pNode;
+    int pos;
+} ListCursor;
+
+typedef enum{
+    eAscending = 0,
+    eDescending
+} eSortOrder;
+
+/* A fixed set of worker threads that run the tasks of one parallel call
+   at a time. The calling thread works as one of the threads. */
+typedef struct{
+    pthread_t* pThreads;
+    int threadCount;
+    pthread_mutex_t lock;
+    pthread_cond_t started;
+    pthread_cond_t finished;
+    unsigned long generation;
+    bool stopping;
+    void (*task)(void* pJob, int index);
+    void* pJob;
+    int taskCount;
+    int nextTask;
+    int doneTasks;
+} ListThreadPool;
+
+/* A detached run of consecutive Nodes handled by one task, together with
+   the partial results of that task. */
+typedef struct{
+    LinkedList list;
+    ListNode* pRemoved;
+    long long sum;
+    ListData min;
+    ListData max;
+} ListSegment;
+
 /* Prototypes:
 LinkedList* createLinkedList();
 bool isEmpty(LinkedList* pList);
@@ -41,14 +160,45 @@ void setData(ListNode* pNode, ListData* pData);
 void setFirstNode(LinkedList* pList, ListNode* Node);
 void setLastNode(LinkedList* pList, ListNode* Node);
 void deleteNode(ListNode* pNode);
+NodePool* createNodePool(int chunkSize);
+void releaseNodePool(NodePool* pPool);
+ListNode* createPooledNode(NodePool* pPool, ListData data);
+LinkedList* createPooledLinkedList(NodePool* pPool);
+ListNode* createListNode(LinkedList* pList, ListData data);
+void destroyLinkedList(LinkedList* pList);
+void enableListIndex(LinkedList* pList);
+void disableListIndex(LinkedList* pList);
+bool insertNodeAt(LinkedList* pList, int pos, ListNode* pNode);
+ListNode* removeNodeAt(LinkedList* pList, int pos);
+void seekListCursor(ListCursor* pCursor, LinkedList* pList, int pos);
+ListNode* getCursorNode(ListCursor* pCursor);
+int getCursorPosition(ListCursor* pCursor);
+void advanceListCursor(ListCursor* pCursor);
+bool concatenateList(LinkedList* pList1, LinkedList* pList2);
+LinkedList* splitAt(LinkedList* pList, int pos);
+bool spliceRange(LinkedList* pDest, ListNode* pAfter, LinkedList* pSrc, int pos, int count);
+void sortList(LinkedList* pList, eSortOrder order);
+void sortListUsingComparator(LinkedList* pList, int (*compare)(ListData* pA, ListData* pB),
+                             eSortOrder order);
+ListThreadPool* createListThreadPool(int threads);
+void destroyListThreadPool(ListThreadPool* pPool);
+void parallelSortList(LinkedList* pList, ListThreadPool* pPool,
+                      int (*compare)(ListData* pA, ListData* pB), eSortOrder order);
+void parallelMapList(LinkedList* pList, ListThreadPool* pPool,
+                     void (*map)(ListData* pData, void* pContext), void* pContext);
+int parallelFilterList(LinkedList* pList, ListThreadPool* pPool,
+                       bool (*keep)(ListData* pData, void* pContext), void* pContext);
+long long parallelSumList(LinkedList* pList, ListThreadPool* pPool);
+bool saveLinkedList(LinkedList* pList, const char* pPath);
+bool openMappedList(MappedList* pMapped, const char* pPath);
+int getMappedListSize(MappedList* pMapped);
+const ListData* getMappedListAt(MappedList* pMapped, int pos);
+void closeMappedList(MappedList* pMapped);
+bool parallelMinList(LinkedList* pList, ListThreadPool* pPool, ListData* pMin);
+bool parallelMaxList(LinkedList* pList, ListThreadPool* pPool, ListData* pMax);
 void printList(LinkedList* pList, void (*printData)(ListData* pData), bool dataFlag);
 void printNode(ListNode* pNode, void (*printData) (ListData* pData));
 void OutofStorage(void);
-
-ListNode* insertNodeAt(LinkedList* pList, ListNode* pNode);
-ListNode* removeNodeAt(LinkedList* pList, ListNode* pNode);
-void sortList(LinkedList* pList, eSortOrder order);
-void concatenateList(LinkedList* pList1, LinkedList* pList2);
 */
 
 /**
@@ -66,7 +216,7 @@ void OutofStorage(void){
  * @return A pointer to the new LinkedList instance.
 */
 LinkedList* createLinkedList(){
-    LinkedList* pLL = (LinkedList*) calloc(1, sizeof(LinkedList));
+    LinkedList* pLL = (LinkedList*) trackedCalloc(1, sizeof(LinkedList));
     if (pLL == NULL)
         OutofStorage();
     return pLL;
@@ -118,7 +268,7 @@ ListNode* getFirstNode(LinkedList* pList){
  * @return A pointer to the last Node.
 */
 ListNode* getLastNode(LinkedList* pList){
-    return pList->pFirstNode;
+    return pList->pLastNode;
 }
 
 /**
@@ -143,6 +293,23 @@ void setLastNode(LinkedList* pList, ListNode* pNode){
     pList->pLastNode = pNode;
 }
 
+/**
+ * Marks the position index of the LinkedList as out of date, so the next
+ * indexed operation rebuilds it. Every function that rearranges the
+ * chain of Nodes without maintaining the index calls this.
+ * 
+ * @param pList A pointer to the LinkedList.
+*/
+static inline void invalidateListIndex(LinkedList* pList){
+    if (pList->pIndex != NULL)
+        pList->pIndex->stale = true;
+}
+
+/* With a position index the pushes and pops below go through these, which
+   keep the index in sync in O(log N). */
+bool insertNodeAt(LinkedList* pList, int pos, ListNode* pNode);
+ListNode* removeNodeAt(LinkedList* pList, int pos);
+
 /**
  * Insert a new Node to the Front of the LinkedList.
  * 
@@ -150,7 +317,13 @@ void setLastNode(LinkedList* pList, ListNode* pNode){
  * @param pNode A pointer to the Node to be added.
 */
 void insertNodetoFront(LinkedList* pList, ListNode* pNode){
+    if (pList->pIndex != NULL){
+        insertNodeAt(pList, 0, pNode);
+        return;
+    }
     ListNode* pNext = getFirstNode(pList);
+    if (isEmpty(pList))
+        setLastNode(pList, pNode);
     setFirstNode(pList, pNode);
     pNode->pNext = pNext;
     pList->nodeCount++;
@@ -158,18 +331,24 @@ void insertNodetoFront(LinkedList* pList, ListNode* pNode){
 
 /**
  * Insert a new Node to the Back of the LinkedList. This function
- * is guaranteed to return in constant time.
+ * is guaranteed to return in constant time, or O(log N) expected time
+ * when the list has a position index.
  * 
  * @param pList A pointer to the LinkedList to add the new Node.
  * @param pNode A pointer to the Node to be added.
 */
 void insertNodetoBack(LinkedList* pList, ListNode* pNode){
+    if (pList->pIndex != NULL){
+        insertNodeAt(pList, getSize(pList), pNode);
+        return;
+    }
+    pNode->pNext = NULL;
     if (isEmpty(pList)){
         setFirstNode(pList, pNode);
-        setLastNode(pList, pNode);
     } else {
         getLastNode(pList)->pNext = pNode;
     }
+    setLastNode(pList, pNode);
     pList->nodeCount++;
 }
 
@@ -186,9 +365,14 @@ void insertNodetoBack(LinkedList* pList, ListNode* pNode){
 ListNode* removeNodefromFront(LinkedList* pList){
     if (isEmpty(pList))
         return NULL;
+    if (pList->pIndex != NULL)
+        return removeNodeAt(pList, 0);
     ListNode* pCurr = getFirstNode(pList);
     setFirstNode(pList, getFirstNode(pList)->pNext);
     pList->nodeCount--;
+    if (isEmpty(pList))
+        setLastNode(pList, NULL);
+    pCurr->pNext = NULL;
     return pCurr;
 }
 
@@ -203,8 +387,14 @@ ListNode* removeNodefromFront(LinkedList* pList){
  * @return A pointer to the unlinked Node.
 */
 ListNode* removeNodefromBack(LinkedList* pList){
+    STATS_START(start);
     if (isEmpty(pList)){
+        STATS_RECORD(eStatsListRemoveBack, start, 0, false);
         return NULL;
+    } else if (pList->pIndex != NULL){
+        /* The index finds the Node before the last one in O(log N); the
+           call is counted as a removeNodeAt. */
+        return removeNodeAt(pList, getSize(pList) - 1);
     } else {
         ListNode* pCurr = getFirstNode(pList);
         ListNode* pPrev = NULL;
@@ -214,40 +404,417 @@ ListNode* removeNodefromBack(LinkedList* pList){
             pCurr = pCurr->pNext;
         }
 
-        pPrev->pNext = NULL;
+        if (pPrev == NULL)
+            setFirstNode(pList, NULL);
+        else
+            pPrev->pNext = NULL;
         setLastNode(pList, pPrev);
         pList->nodeCount--;
 
+        STATS_RECORD(eStatsListRemoveBack, start, getSize(pList), pPrev == NULL);
         return pCurr;
     }
 }
 
 /**
- * Gets the Node at the given position.
+ * Allocates a tower of the position index for the given Node.
+ * 
+ * @param pNode The Node the tower stands on, or NULL for the head.
+ * @param height The number of levels of the tower.
+ * @return A pointer to the new tower.
+*/
+static IndexTower* createIndexTower(ListNode* pNode, int height){
+    IndexTower* pTower = (IndexTower*) trackedMalloc(sizeof(IndexTower)
+                                              + height * sizeof(IndexLink));
+    if (pTower == NULL)
+        OutofStorage();
+    pTower->pNode = pNode;
+    pTower->height = height;
+    return pTower;
+}
+
+/**
+ * Draws the height of a new tower. A Node gets a tower of at least one
+ * level with a chance of 1 in 4, and every further level with the same
+ * chance, so a lookup walks about four Nodes at the bottom.
+ * 
+ * @param pIndex A pointer to the ListIndex.
+ * @return The height, 0 when the Node gets no tower.
+*/
+static int randomTowerHeight(ListIndex* pIndex){
+    unsigned int x = pIndex->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    pIndex->seed = x;
+
+    int height = 0;
+    while ((x & 3) == 0 && height < LIST_INDEX_LEVELS){
+        height++;
+        x >>= 2;
+    }
+    return height;
+}
+
+/**
+ * Frees every tower of the position index except the head.
+ * 
+ * @param pIndex A pointer to the ListIndex.
+*/
+static void clearListIndex(ListIndex* pIndex){
+    IndexTower* pTower = pIndex->pHead->links[0].pNext;
+    while (pTower != NULL){
+        IndexTower* pNext = pTower->links[0].pNext;
+        trackedFree(pTower);
+        pTower = pNext;
+    }
+}
+
+/**
+ * Builds the position index of the LinkedList from scratch in one pass.
+ * Positions are counted from 1, with the head tower at 0.
+ * 
+ * @param pList A pointer to the LinkedList with an index.
+*/
+static void rebuildListIndex(LinkedList* pList){
+    ListIndex* pIndex = pList->pIndex;
+    IndexTower* pLast[LIST_INDEX_LEVELS];
+    int lastRank[LIST_INDEX_LEVELS];
+
+    clearListIndex(pIndex);
+    for (int i = 0; i < LIST_INDEX_LEVELS; i++){
+        pLast[i] = pIndex->pHead;
+        lastRank[i] = 0;
+        pIndex->pHead->links[i].pNext = NULL;
+    }
+
+    int rank = 1;
+    for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext, rank++){
+        int height = randomTowerHeight(pIndex);
+        if (height == 0)
+            continue;
+
+        IndexTower* pTower = createIndexTower(pNode, height);
+        for (int i = 0; i < height; i++){
+            pLast[i]->links[i].pNext = pTower;
+            pLast[i]->links[i].span = rank - lastRank[i];
+            pTower->links[i].pNext = NULL;
+            pLast[i] = pTower;
+            lastRank[i] = rank;
+        }
+    }
+
+    for (int i = 0; i < LIST_INDEX_LEVELS; i++)
+        pLast[i]->links[i].span = getSize(pList) - lastRank[i];
+    pIndex->stale = false;
+}
+
+/**
+ * Turns on the position index of the LinkedList, which makes getNode,
+ * insertNodeAt and removeNodeAt take O(log N) expected time. A tower is
+ * built on a Node with probability 1/4, so the index costs about one
+ * extra allocation per four Nodes. Pushes and pops at either end keep the
+ * index in sync; other functions that rearrange the chain mark it out of
+ * date, and the next indexed operation rebuilds it in O(N).
+ * 
+ * @param pList A pointer to the LinkedList.
+*/
+void enableListIndex(LinkedList* pList){
+    if (pList->pIndex != NULL)
+        return;
+
+    ListIndex* pIndex = (ListIndex*) trackedMalloc(sizeof(ListIndex));
+    if (pIndex == NULL)
+        OutofStorage();
+    pIndex->pHead = createIndexTower(NULL, LIST_INDEX_LEVELS);
+    pIndex->pHead->links[0].pNext = NULL;
+    pIndex->seed = 2463534242u;
+    pList->pIndex = pIndex;
+    rebuildListIndex(pList);
+}
+
+/**
+ * Turns off the position index of the LinkedList and frees it.
+ * 
+ * @param pList A pointer to the LinkedList.
+*/
+void disableListIndex(LinkedList* pList){
+    ListIndex* pIndex = pList->pIndex;
+    if (pIndex == NULL)
+        return;
+    clearListIndex(pIndex);
+    trackedFree(pIndex->pHead);
+    trackedFree(pIndex);
+    pList->pIndex = NULL;
+}
+
+/**
+ * Gets the position index of the LinkedList, rebuilt if it is out of date.
+ * 
+ * @param pList A pointer to the LinkedList.
+ * @return A pointer to the ListIndex, or NULL if the list has none.
+*/
+static ListIndex* getListIndex(LinkedList* pList){
+    if (pList->pIndex != NULL && pList->pIndex->stale)
+        rebuildListIndex(pList);
+    return pList->pIndex;
+}
+
+/**
+ * Finds the last tower on every level that stands before the given rank.
+ * 
+ * @param pIndex A pointer to the ListIndex.
+ * @param rank The rank to search for, counted from 1.
+ * @param pUpdate Set to the tower found on each level.
+ * @param pRanks Set to the rank of the tower found on each level.
+*/
+static void findIndexPath(ListIndex* pIndex, int rank, IndexTower** pUpdate, int* pRanks){
+    IndexTower* pTower = pIndex->pHead;
+    int r = 0;
+
+    for (int i = LIST_INDEX_LEVELS - 1; i >= 0; i--){
+        while (pTower->links[i].pNext != NULL && r + pTower->links[i].span < rank){
+            r += pTower->links[i].span;
+            pTower = pTower->links[i].pNext;
+        }
+        pUpdate[i] = pTower;
+        pRanks[i] = r;
+    }
+}
+
+/**
+ * Walks the Nodes from a tower of the position index to the given rank.
+ * 
+ * @param pList A pointer to the LinkedList.
+ * @param pTower The tower to start from.
+ * @param r The rank of the tower.
+ * @param rank The rank of the wanted Node, at least r and 1.
+ * @return A pointer to the Node at the given rank.
+*/
+static ListNode* walkFromTower(LinkedList* pList, IndexTower* pTower, int r, int rank){
+    ListNode* pNode = pTower->pNode;
+    if (pNode == NULL){
+        pNode = getFirstNode(pList);
+        r = 1;
+    }
+    for (; r < rank; r++)
+        pNode = pNode->pNext;
+    return pNode;
+}
+
+/**
+ * Gets the Node at the given position. This walks the list, unless the
+ * list has a position index.
  * 
  * @param pList A pointer to the LinkedList to get the Node from.
  * @param pos The position of the Node.
- * @return A ponter to the Node at the given position.
+ * @return A pointer to the Node at the given position, or NULL if the
+ * position is outside the list.
 */
 ListNode* getNode(LinkedList* pList, int pos){
-    ListNode* pCurr = getFirstNode(pList);
-
-    if (isEmpty(pList)){
+    STATS_START(start);
+    if (pos < 0 || pos >= getSize(pList)){
+        STATS_RECORD(eStatsListGetNode, start, 0, false);
         return NULL;
-    } else if (pos == 0){
+    }
+    if (pos == getSize(pList) - 1){
+        STATS_RECORD(eStatsListGetNode, start, 0, false);
+        return getLastNode(pList);
+    }
+
+    ListIndex* pIndex = getListIndex(pList);
+    if (pIndex == NULL){
+        ListNode* pCurr = getFirstNode(pList);
+        for (int i = 0; i < pos; i++)
+            pCurr = pCurr->pNext;
+        STATS_RECORD(eStatsListGetNode, start, pos, false);
         return pCurr;
+    }
+
+    IndexTower* pTower = pIndex->pHead;
+    int r = 0;
+    int hops = 0;
+    for (int i = LIST_INDEX_LEVELS - 1; i >= 0; i--)
+        while (pTower->links[i].pNext != NULL && r + pTower->links[i].span <= pos + 1){
+            r += pTower->links[i].span;
+            pTower = pTower->links[i].pNext;
+            STATS_STEP(hops, 1);
+        }
+    ListNode* pNode = walkFromTower(pList, pTower, r, pos + 1);
+    STATS_RECORD(eStatsListGetNode, start, hops + pos + 1 - (r > 0 ? r : 1), true);
+    return pNode;
+}
+
+/**
+ * Insert a Node so that it ends up at the given position.
+ * 
+ * @param pList A pointer to the LinkedList to add the Node.
+ * @param pos The position of the new Node, between 0 and the size.
+ * @param pNode A pointer to the Node to be added.
+ * @return false if the position is outside the list.
+*/
+bool insertNodeAt(LinkedList* pList, int pos, ListNode* pNode){
+    STATS_START(start);
+    if (pos < 0 || pos > getSize(pList)){
+        STATS_RECORD(eStatsListInsertAt, start, 0, false);
+        return false;
+    }
+
+    ListIndex* pIndex = getListIndex(pList);
+    IndexTower* pUpdate[LIST_INDEX_LEVELS];
+    int ranks[LIST_INDEX_LEVELS];
+    ListNode* pPrev = NULL;
+    int steps = 0;
+
+    if (pIndex != NULL){
+        findIndexPath(pIndex, pos + 1, pUpdate, ranks);
+        if (pos > 0){
+            pPrev = walkFromTower(pList, pUpdate[0], ranks[0], pos);
+            STATS_STEP(steps, pos - (ranks[0] > 0 ? ranks[0] : 1));
+        }
     } else if (pos == getSize(pList)){
-        return getLastNode(pList);
+        pPrev = getLastNode(pList);
+    } else if (pos > 0){
+        pPrev = getNode(pList, pos - 1);
+        STATS_STEP(steps, pos - 1);
+    }
+
+    if (pPrev == NULL){
+        pNode->pNext = getFirstNode(pList);
+        setFirstNode(pList, pNode);
     } else {
-        int i = 0;
-        while (pCurr->pNext != NULL){
-            if (i == pos)
-                return pCurr;
-            i++;
-            pCurr = pCurr->pNext;
+        pNode->pNext = pPrev->pNext;
+        pPrev->pNext = pNode;
+    }
+    if (pNode->pNext == NULL)
+        setLastNode(pList, pNode);
+    pList->nodeCount++;
+
+    if (pIndex != NULL){
+        int height = randomTowerHeight(pIndex);
+        IndexTower* pTower = height > 0 ? createIndexTower(pNode, height) : NULL;
+        for (int i = 0; i < LIST_INDEX_LEVELS; i++){
+            IndexLink* pLink = &pUpdate[i]->links[i];
+            if (i < height){
+                pTower->links[i].pNext = pLink->pNext;
+                pTower->links[i].span = pLink->span - (pos - ranks[i]);
+                pLink->pNext = pTower;
+                pLink->span = pos - ranks[i] + 1;
+            } else {
+                pLink->span++;
+            }
         }
-        return pCurr;
     }
+    STATS_RECORD(eStatsListInsertAt, start, steps, pIndex != NULL);
+    return true;
+}
+
+/**
+ * Removes the Node at the given position from the LinkedList and returns
+ * it. Like removeNodefromFront, this only unlinks the Node.
+ * 
+ * @param pList A pointer to the LinkedList to unlink the Node from.
+ * @param pos The position of the Node.
+ * @return A pointer to the unlinked Node, or NULL if the position is
+ * outside the list.
+*/
+ListNode* removeNodeAt(LinkedList* pList, int pos){
+    STATS_START(start);
+    if (pos < 0 || pos >= getSize(pList)){
+        STATS_RECORD(eStatsListRemoveAt, start, 0, false);
+        return NULL;
+    }
+
+    ListIndex* pIndex = getListIndex(pList);
+    IndexTower* pUpdate[LIST_INDEX_LEVELS];
+    int ranks[LIST_INDEX_LEVELS];
+    ListNode* pPrev = NULL;
+    int steps = 0;
+
+    if (pIndex != NULL){
+        findIndexPath(pIndex, pos + 1, pUpdate, ranks);
+        if (pos > 0){
+            pPrev = walkFromTower(pList, pUpdate[0], ranks[0], pos);
+            STATS_STEP(steps, pos - (ranks[0] > 0 ? ranks[0] : 1));
+        }
+    } else if (pos > 0){
+        pPrev = getNode(pList, pos - 1);
+        STATS_STEP(steps, pos - 1);
+    }
+
+    ListNode* pNode = pPrev == NULL ? getFirstNode(pList) : pPrev->pNext;
+    if (pPrev == NULL)
+        setFirstNode(pList, pNode->pNext);
+    else
+        pPrev->pNext = pNode->pNext;
+    if (getLastNode(pList) == pNode)
+        setLastNode(pList, pPrev);
+    pList->nodeCount--;
+    pNode->pNext = NULL;
+
+    if (pIndex != NULL){
+        IndexTower* pTower = NULL;
+        for (int i = 0; i < LIST_INDEX_LEVELS; i++){
+            IndexLink* pLink = &pUpdate[i]->links[i];
+            if (pLink->pNext != NULL && pLink->pNext->pNode == pNode){
+                pTower = pLink->pNext;
+                pLink->span += pTower->links[i].span - 1;
+                pLink->pNext = pTower->links[i].pNext;
+            } else {
+                pLink->span--;
+            }
+        }
+        trackedFree(pTower);
+    }
+    STATS_RECORD(eStatsListRemoveAt, start, steps, pIndex != NULL);
+    return pNode;
+}
+
+/**
+ * Places the ListCursor on the given position of the LinkedList. A
+ * cursor must be placed again after Nodes are inserted or removed before
+ * its position.
+ * 
+ * @param pCursor A pointer to the ListCursor.
+ * @param pList A pointer to the LinkedList.
+ * @param pos The position, between 0 and the size.
+*/
+void seekListCursor(ListCursor* pCursor, LinkedList* pList, int pos){
+    pCursor->pList = pList;
+    pCursor->pos = pos;
+    pCursor->pNode = getNode(pList, pos);
+}
+
+/**
+ * Gets the Node under the ListCursor.
+ * 
+ * @param pCursor A pointer to the ListCursor.
+ * @return A pointer to the Node, or NULL past the end of the list.
+*/
+ListNode* getCursorNode(ListCursor* pCursor){
+    return pCursor->pNode;
+}
+
+/**
+ * Gets the position of the ListCursor.
+ * 
+ * @param pCursor A pointer to the ListCursor.
+ * @return The position of the Node under the cursor.
+*/
+int getCursorPosition(ListCursor* pCursor){
+    return pCursor->pos;
+}
+
+/**
+ * Moves the ListCursor to the next position in constant time.
+ * 
+ * @param pCursor A pointer to the ListCursor.
+*/
+void advanceListCursor(ListCursor* pCursor){
+    if (pCursor->pNode == NULL)
+        return;
+    pCursor->pNode = pCursor->pNode->pNext;
+    pCursor->pos++;
 }
 
 /**
@@ -271,13 +838,14 @@ void setData(ListNode* pNode, ListData* pData){
 }
 
 /**
- * Creates a new Node structure using the given data.
+ * Creates a new Node structure using the given data. deleteNode frees
+ * the data, so it must come from trackedMalloc or trackedCalloc.
  * 
  * @param pData A pointer to the data to be stored in the Node.
  * @return A pointer to the created Node structure.
 */
 ListNode* createNode(ListData* pData){
-    ListNode* pNewNode = (ListNode*) calloc(1, sizeof(ListNode));
+    ListNode* pNewNode = (ListNode*) trackedCalloc(1, sizeof(ListNode));
 
     if (pNewNode == NULL)
         OutofStorage();
@@ -287,12 +855,926 @@ ListNode* createNode(ListData* pData){
 
 /**
  * Deallocate both the data stored in the Node and the Node itself.
+ * A Node that came from a NodePool is handed back to its pool instead.
  * 
  * @param pNode A pointer to the Node to be deallocated.
 */
 void deleteNode(ListNode* pNode){
-    free(getData(pNode));
-    free(pNode);
+    NodePool* pPool = pNode->pPool;
+    if (pPool != NULL){
+        pNode->pNext = pPool->pFreeNodes;
+        pPool->pFreeNodes = pNode;
+        return;
+    }
+    trackedFree(getData(pNode));
+    trackedFree(pNode);
+}
+
+/**
+ * Creates a NodePool that hands out Nodes from contiguous chunks. Each
+ * Node is stored in the same slot as its data, so a pooled Node costs a
+ * single allocation per chunk instead of two per Node.
+ * 
+ * @param chunkSize The number of Nodes in each chunk, or 0 for the default.
+ * @return A pointer to the new NodePool.
+*/
+NodePool* createNodePool(int chunkSize){
+    NodePool* pPool = (NodePool*) trackedCalloc(1, sizeof(NodePool));
+    if (pPool == NULL)
+        OutofStorage();
+    pPool->chunkSize = chunkSize > 0 ? chunkSize : POOL_CHUNK_SIZE;
+    pPool->usedSlots = pPool->chunkSize;
+    pPool->refCount = 1;
+    return pPool;
+}
+
+/**
+ * Drops a reference to the NodePool. The last reference frees every
+ * chunk at once, together with all the Nodes still taken from them.
+ * 
+ * @param pPool A pointer to the NodePool to be released.
+*/
+void releaseNodePool(NodePool* pPool){
+    if (--pPool->refCount > 0)
+        return;
+
+    PoolChunk* pChunk = pPool->pChunks;
+    while (pChunk != NULL){
+        PoolChunk* pNext = pChunk->pNext;
+        trackedFree(pChunk);
+        pChunk = pNext;
+    }
+    trackedFree(pPool);
+}
+
+/**
+ * Takes a Node from the NodePool and stores a copy of the given data in
+ * it. Nodes returned by deleteNode are reused before a new chunk is
+ * allocated.
+ * 
+ * @param pPool A pointer to the NodePool to take the Node from.
+ * @param data The data to be stored in the Node.
+ * @return A pointer to the Node.
+*/
+ListNode* createPooledNode(NodePool* pPool, ListData data){
+    PoolSlot* pSlot;
+
+    if (pPool->pFreeNodes != NULL){
+        pSlot = (PoolSlot*) pPool->pFreeNodes;
+        pPool->pFreeNodes = pSlot->node.pNext;
+    } else {
+        if (pPool->usedSlots == pPool->chunkSize){
+            PoolChunk* pChunk = (PoolChunk*) trackedMalloc(sizeof(PoolChunk)
+                    + (size_t) pPool->chunkSize * sizeof(PoolSlot));
+            if (pChunk == NULL)
+                OutofStorage();
+            pChunk->pNext = pPool->pChunks;
+            pPool->pChunks = pChunk;
+            pPool->usedSlots = 0;
+        }
+        pSlot = &pPool->pChunks->slots[pPool->usedSlots++];
+    }
+
+    pSlot->data = data;
+    pSlot->node.pNext = NULL;
+    pSlot->node.pData = &pSlot->data;
+    pSlot->node.pPool = pPool;
+    return &pSlot->node;
+}
+
+/**
+ * Creates an instance of a LinkedList whose Nodes come from a NodePool.
+ * Several lists may share one pool, which lets Nodes move between them.
+ * 
+ * @param pPool The NodePool to use, or NULL to create a new one.
+ * @return A pointer to the new LinkedList instance.
+*/
+LinkedList* createPooledLinkedList(NodePool* pPool){
+    LinkedList* pLL = createLinkedList();
+    if (pPool == NULL)
+        pPool = createNodePool(0);
+    else
+        pPool->refCount++;
+    pLL->pPool = pPool;
+    return pLL;
+}
+
+/**
+ * Creates a new Node for the given LinkedList. The Node is taken from the
+ * pool of the list if it has one, otherwise it is allocated on the heap.
+ * 
+ * @param pList A pointer to the LinkedList the Node is created for.
+ * @param data The data to be stored in the Node.
+ * @return A pointer to the created Node.
+*/
+ListNode* createListNode(LinkedList* pList, ListData data){
+    if (pList->pPool != NULL)
+        return createPooledNode(pList->pPool, data);
+
+    ListData* pData = (ListData*) trackedMalloc(sizeof(ListData));
+    if (pData == NULL)
+        OutofStorage();
+    *pData = data;
+    return createNode(pData);
+}
+
+/**
+ * Deallocate the LinkedList and every Node in it. When the list is the
+ * last user of its NodePool, the pool chunks are freed as a whole without
+ * visiting the Nodes.
+ * 
+ * @note A pooled LinkedList must only hold Nodes taken from its pool.
+ * 
+ * @param pList A pointer to the LinkedList to be deallocated.
+*/
+void destroyLinkedList(LinkedList* pList){
+    NodePool* pPool = pList->pPool;
+
+    disableListIndex(pList);
+    if (pPool == NULL || pPool->refCount > 1){
+        ListNode* pCurr = getFirstNode(pList);
+        while (pCurr != NULL){
+            ListNode* pNext = pCurr->pNext;
+            deleteNode(pCurr);
+            pCurr = pNext;
+        }
+    }
+    if (pPool != NULL)
+        releaseNodePool(pPool);
+    trackedFree(pList);
+}
+
+/**
+ * Checks whether Nodes may move from one LinkedList to another. A pooled
+ * LinkedList must only hold Nodes of its own pool, so both lists have to
+ * share the same NodePool, or both have to use the heap.
+ * 
+ * @param pDest A pointer to the LinkedList receiving the Nodes.
+ * @param pSrc A pointer to the LinkedList giving up the Nodes.
+ * @return true if the Nodes may move.
+*/
+static bool canMoveNodes(LinkedList* pDest, LinkedList* pSrc){
+    return pDest->pPool == pSrc->pPool;
+}
+
+/**
+ * Moves every Node of the second LinkedList to the back of the first one
+ * and leaves the second one empty. This function is guaranteed to return
+ * in constant time.
+ * 
+ * @param pList1 A pointer to the LinkedList to append to.
+ * @param pList2 A pointer to the LinkedList whose Nodes are moved.
+ * @return false if the lists do not share a NodePool, and nothing moved.
+*/
+bool concatenateList(LinkedList* pList1, LinkedList* pList2){
+    if (!canMoveNodes(pList1, pList2))
+        return false;
+    if (pList1 == pList2 || isEmpty(pList2))
+        return true;
+    invalidateListIndex(pList1);
+    invalidateListIndex(pList2);
+
+    if (isEmpty(pList1))
+        setFirstNode(pList1, getFirstNode(pList2));
+    else
+        getLastNode(pList1)->pNext = getFirstNode(pList2);
+    setLastNode(pList1, getLastNode(pList2));
+    pList1->nodeCount += getSize(pList2);
+
+    setFirstNode(pList2, NULL);
+    setLastNode(pList2, NULL);
+    setSize(pList2, 0);
+    return true;
+}
+
+/**
+ * Splits the LinkedList in two. The Nodes from the given position on are
+ * moved to a new LinkedList, which shares the NodePool of the original.
+ * Finding the position takes pos steps, but no Node is copied.
+ * 
+ * @param pList A pointer to the LinkedList to be split.
+ * @param pos The position of the first Node to move, between 0 and the size.
+ * @return A pointer to the new LinkedList, or NULL if pos is outside the list.
+*/
+LinkedList* splitAt(LinkedList* pList, int pos){
+    if (pos < 0 || pos > getSize(pList))
+        return NULL;
+
+    LinkedList* pTail = pList->pPool != NULL
+                        ? createPooledLinkedList(pList->pPool) : createLinkedList();
+    if (pos == getSize(pList))
+        return pTail;
+    if (pos == 0){
+        concatenateList(pTail, pList);
+        return pTail;
+    }
+
+    ListNode* pPrev = getNode(pList, pos - 1);
+    invalidateListIndex(pList);
+
+    setFirstNode(pTail, pPrev->pNext);
+    setLastNode(pTail, getLastNode(pList));
+    setSize(pTail, getSize(pList) - pos);
+
+    pPrev->pNext = NULL;
+    setLastNode(pList, pPrev);
+    setSize(pList, pos);
+    return pTail;
+}
+
+/**
+ * Moves a run of consecutive Nodes from one LinkedList into another,
+ * right after the given Node. The run is relinked as a whole, so nothing
+ * is copied or allocated. Finding the run takes pos + count steps in the
+ * source list, and linking it in takes constant time.
+ * 
+ * @param pDest A pointer to the LinkedList receiving the Nodes.
+ * @param pAfter The Node of pDest to insert after, or NULL for the front.
+ * @param pSrc A pointer to the LinkedList giving up the Nodes.
+ * @param pos The position of the first Node to move in pSrc.
+ * @param count The number of Nodes to move.
+ * @return false if the range is outside pSrc, the lists are the same or
+ * they do not share a NodePool. Nothing is moved in that case.
+*/
+bool spliceRange(LinkedList* pDest, ListNode* pAfter, LinkedList* pSrc, int pos, int count){
+    if (pDest == pSrc || !canMoveNodes(pDest, pSrc))
+        return false;
+    if (pos < 0 || count < 0 || pos + count > getSize(pSrc))
+        return false;
+    if (count == 0)
+        return true;
+
+    ListNode* pPrev = pos > 0 ? getNode(pSrc, pos - 1) : NULL;
+    ListNode* pFirst = pPrev == NULL ? getFirstNode(pSrc) : pPrev->pNext;
+    invalidateListIndex(pDest);
+    invalidateListIndex(pSrc);
+    ListNode* pLast = pFirst;
+    for (int i = 1; i < count; i++)
+        pLast = pLast->pNext;
+
+    if (pPrev == NULL)
+        setFirstNode(pSrc, pLast->pNext);
+    else
+        pPrev->pNext = pLast->pNext;
+    if (getLastNode(pSrc) == pLast)
+        setLastNode(pSrc, pPrev);
+    pSrc->nodeCount -= count;
+
+    if (pAfter == NULL){
+        pLast->pNext = getFirstNode(pDest);
+        setFirstNode(pDest, pFirst);
+    } else {
+        pLast->pNext = pAfter->pNext;
+        pAfter->pNext = pFirst;
+    }
+    if (pLast->pNext == NULL)
+        setLastNode(pDest, pLast);
+    pDest->nodeCount += count;
+    return true;
+}
+
+/**
+ * Compares two data values in their natural order.
+ * 
+ * @param pA A pointer to the first data.
+ * @param pB A pointer to the second data.
+ * @return A negative number, zero or a positive number as the first data
+ * is less than, equal to or greater than the second.
+*/
+int compareData(ListData* pA, ListData* pB){
+    return (*pA > *pB) - (*pA < *pB);
+}
+
+/**
+ * Merges two sorted runs of Nodes into one. On equal data the Node of the
+ * left run goes first, which keeps the sort stable.
+ * 
+ * @param pLeft The run holding the earlier Nodes.
+ * @param pRight The run holding the later Nodes.
+ * @param compare The function that orders two data values.
+ * @param direction 1 to sort in the order of compare, -1 to reverse it.
+ * @param ppTail Set to the last Node of the merged run, unless it is NULL.
+ * @return The first Node of the merged run.
+*/
+static inline ListNode* mergeRuns(ListNode* pLeft, ListNode* pRight,
+                                  int (*compare)(ListData* pA, ListData* pB),
+                                  int direction, ListNode** ppTail){
+    ListNode head;
+    ListNode* pTail = &head;
+
+    while (pLeft != NULL && pRight != NULL){
+        if (direction * compare(getData(pRight), getData(pLeft)) < 0){
+            pTail->pNext = pRight;
+            pRight = pRight->pNext;
+        } else {
+            pTail->pNext = pLeft;
+            pLeft = pLeft->pNext;
+        }
+        pTail = pTail->pNext;
+    }
+    pTail->pNext = pLeft != NULL ? pLeft : pRight;
+
+    if (ppTail != NULL){
+        while (pTail->pNext != NULL)
+            pTail = pTail->pNext;
+        *ppTail = pTail;
+    }
+    return head.pNext;
+}
+
+/**
+ * Sorts the LinkedList with a bottom-up merge sort over the pNext links.
+ * The Nodes are taken off the front one at a time and carried into a
+ * small array of pending runs, where runs[i] holds 2^i Nodes, like the
+ * digits of a binary counter. Each merge works on Nodes that were touched
+ * recently, so the sort stays in cache far longer than merging the whole
+ * list once per run width, and it needs no memory besides the array.
+ * 
+ * @param pList A pointer to the LinkedList to be sorted.
+ * @param compare The function that orders two data values.
+ * @param direction 1 to sort in the order of compare, -1 to reverse it.
+*/
+static inline void mergeSortList(LinkedList* pList, int (*compare)(ListData* pA, ListData* pB),
+                                 int direction){
+    ListNode* runs[8 * sizeof(int)] = {NULL};
+    ListNode* pNode = getFirstNode(pList);
+    ListNode* pTail = NULL;
+    int top = 0;
+
+    if (pNode == NULL)
+        return;
+    invalidateListIndex(pList);
+
+    while (pNode != NULL){
+        ListNode* pCarry = pNode;
+        pNode = pNode->pNext;
+        pCarry->pNext = NULL;
+
+        int i = 0;
+        for (; runs[i] != NULL; i++){
+            pCarry = mergeRuns(runs[i], pCarry, compare, direction, NULL);
+            runs[i] = NULL;
+        }
+        runs[i] = pCarry;
+        if (i >= top)
+            top = i + 1;
+    }
+
+    /* Only the last merge has to find the tail of the sorted list. */
+    ListNode* pResult = NULL;
+    for (int i = 0; i < top; i++)
+        if (runs[i] != NULL)
+            pResult = mergeRuns(runs[i], pResult, compare, direction,
+                                i == top - 1 ? &pTail : NULL);
+
+    setFirstNode(pList, pResult);
+    setLastNode(pList, pTail);
+}
+
+/**
+ * Sorts the LinkedList by its data. The sort is stable and relinks the
+ * existing Nodes without allocating memory.
+ * 
+ * @param pList A pointer to the LinkedList to be sorted.
+ * @param order Whether to sort in ascending or descending order.
+*/
+void sortList(LinkedList* pList, eSortOrder order){
+    mergeSortList(pList, compareData, order == eDescending ? -1 : 1);
+}
+
+/**
+ * Sorts the LinkedList using the given comparator. The sort is stable and
+ * relinks the existing Nodes without allocating memory.
+ * 
+ * @param pList A pointer to the LinkedList to be sorted.
+ * @param compare The function that returns a negative number, zero or a
+ * positive number as its first argument orders before, with or after the
+ * second.
+ * @param order eAscending to follow the comparator, eDescending to reverse it.
+*/
+void sortListUsingComparator(LinkedList* pList, int (*compare)(ListData* pA, ListData* pB),
+                             eSortOrder order){
+    mergeSortList(pList, compare, order == eDescending ? -1 : 1);
+}
+
+/**
+ * Runs the tasks of the current parallel call until none are left.
+ * Called with the lock of the pool held, and returns with it held.
+ * 
+ * @param pPool A pointer to the ListThreadPool.
+*/
+static void drainListTasks(ListThreadPool* pPool){
+    while (pPool->nextTask < pPool->taskCount){
+        int index = pPool->nextTask++;
+        pthread_mutex_unlock(&pPool->lock);
+        pPool->task(pPool->pJob, index);
+        pthread_mutex_lock(&pPool->lock);
+        if (++pPool->doneTasks == pPool->taskCount)
+            pthread_cond_signal(&pPool->finished);
+    }
+}
+
+/**
+ * The loop of every worker thread. It sleeps until a new parallel call
+ * is posted, helps to run its tasks and goes back to sleep.
+ * 
+ * @param pArg A pointer to the ListThreadPool.
+ * @return NULL.
+*/
+static void* runListWorker(void* pArg){
+    ListThreadPool* pPool = (ListThreadPool*) pArg;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pPool->lock);
+    while (true){
+        while (pPool->generation == seen && !pPool->stopping)
+            pthread_cond_wait(&pPool->started, &pPool->lock);
+        if (pPool->stopping)
+            break;
+        seen = pPool->generation;
+        drainListTasks(pPool);
+    }
+    pthread_mutex_unlock(&pPool->lock);
+    return NULL;
+}
+
+/**
+ * Creates a ListThreadPool. The threads are started once and reused by
+ * every parallel call, so a call only pays for waking them up.
+ * 
+ * @param threads The number of threads, including the calling thread.
+ * @return A pointer to the new ListThreadPool.
+*/
+ListThreadPool* createListThreadPool(int threads){
+    ListThreadPool* pPool = (ListThreadPool*) trackedCalloc(1, sizeof(ListThreadPool));
+    if (pPool == NULL)
+        OutofStorage();
+    pPool->threadCount = threads > 0 ? threads : 1;
+    pPool->pThreads = (pthread_t*) trackedMalloc(pPool->threadCount * sizeof(pthread_t));
+    if (pPool->pThreads == NULL)
+        OutofStorage();
+    pthread_mutex_init(&pPool->lock, NULL);
+    pthread_cond_init(&pPool->started, NULL);
+    pthread_cond_init(&pPool->finished, NULL);
+
+    for (int i = 1; i < pPool->threadCount; i++)
+        pthread_create(&pPool->pThreads[i], NULL, runListWorker, pPool);
+    return pPool;
+}
+
+/**
+ * Stops the worker threads and deallocates the ListThreadPool.
+ * 
+ * @param pPool A pointer to the ListThreadPool to be deallocated.
+*/
+void destroyListThreadPool(ListThreadPool* pPool){
+    pthread_mutex_lock(&pPool->lock);
+    pPool->stopping = true;
+    pthread_cond_broadcast(&pPool->started);
+    pthread_mutex_unlock(&pPool->lock);
+
+    for (int i = 1; i < pPool->threadCount; i++)
+        pthread_join(pPool->pThreads[i], NULL);
+    pthread_cond_destroy(&pPool->finished);
+    pthread_cond_destroy(&pPool->started);
+    pthread_mutex_destroy(&pPool->lock);
+    trackedFree(pPool->pThreads);
+    trackedFree(pPool);
+}
+
+/**
+ * Runs task(pJob, index) for every index below taskCount on the threads
+ * of the pool and returns when all of them are done.
+ * 
+ * @param pPool A pointer to the ListThreadPool.
+ * @param task The function to run.
+ * @param pJob The state shared by the tasks.
+ * @param taskCount The number of tasks.
+*/
+static void runListTasks(ListThreadPool* pPool, void (*task)(void* pJob, int index),
+                         void* pJob, int taskCount){
+    pthread_mutex_lock(&pPool->lock);
+    pPool->task = task;
+    pPool->pJob = pJob;
+    pPool->taskCount = taskCount;
+    pPool->nextTask = 0;
+    pPool->doneTasks = 0;
+    pPool->generation++;
+    pthread_cond_broadcast(&pPool->started);
+
+    drainListTasks(pPool);
+    while (pPool->doneTasks < pPool->taskCount)
+        pthread_cond_wait(&pPool->finished, &pPool->lock);
+    pthread_mutex_unlock(&pPool->lock);
+}
+
+/**
+ * Cuts the LinkedList into segments of nearly equal size in one pass and
+ * leaves the LinkedList empty. joinListSegments puts them back.
+ * 
+ * @param pList A pointer to the LinkedList to be split.
+ * @param pSegments The array of segments to fill.
+ * @param segmentCount The number of segments.
+*/
+static void splitListSegments(LinkedList* pList, ListSegment* pSegments, int segmentCount){
+    ListNode* pNode = getFirstNode(pList);
+    int n = getSize(pList);
+
+    for (int s = 0; s < segmentCount; s++){
+        ListSegment* pSegment = &pSegments[s];
+        int count = (int) ((long long) n * (s + 1) / segmentCount
+                           - (long long) n * s / segmentCount);
+
+        pSegment->list = (LinkedList) {NULL, NULL, count, pList->pPool};
+        pSegment->pRemoved = NULL;
+        if (count == 0)
+            continue;
+
+        pSegment->list.pFirstNode = pNode;
+        for (int i = 1; i < count; i++)
+            pNode = pNode->pNext;
+        pSegment->list.pLastNode = pNode;
+        pNode = pNode->pNext;
+        pSegment->list.pLastNode->pNext = NULL;
+    }
+
+    setFirstNode(pList, NULL);
+    setLastNode(pList, NULL);
+    setSize(pList, 0);
+}
+
+/**
+ * Links the segments back into the LinkedList in their order.
+ * 
+ * @param pList A pointer to the empty LinkedList.
+ * @param pSegments The array of segments.
+ * @param segmentCount The number of segments.
+*/
+static void joinListSegments(LinkedList* pList, ListSegment* pSegments, int segmentCount){
+    for (int s = 0; s < segmentCount; s++){
+        LinkedList* pPart = &pSegments[s].list;
+        if (isEmpty(pPart))
+            continue;
+        if (isEmpty(pList))
+            setFirstNode(pList, getFirstNode(pPart));
+        else
+            getLastNode(pList)->pNext = getFirstNode(pPart);
+        setLastNode(pList, getLastNode(pPart));
+        pList->nodeCount += getSize(pPart);
+    }
+}
+
+/* The arguments of one parallel call, shared by all of its tasks. */
+typedef struct{
+    ListSegment* pSegments;
+    int (*compare)(ListData* pA, ListData* pB);
+    int direction;
+    int step;
+    void (*map)(ListData* pData, void* pContext);
+    bool (*keep)(ListData* pData, void* pContext);
+    void* pContext;
+} ListJob;
+
+static void sortSegmentTask(void* pArg, int index){
+    ListJob* pJob = (ListJob*) pArg;
+    mergeSortList(&pJob->pSegments[index].list, pJob->compare, pJob->direction);
+}
+
+/* Merges segment 2 * step * index with the segment step places after it. */
+static void mergeSegmentTask(void* pArg, int index){
+    ListJob* pJob = (ListJob*) pArg;
+    LinkedList* pLeft = &pJob->pSegments[2 * pJob->step * index].list;
+    LinkedList* pRight = &pJob->pSegments[2 * pJob->step * index + pJob->step].list;
+
+    if (isEmpty(pRight))
+        return;
+    if (isEmpty(pLeft)){
+        *pLeft = *pRight;
+    } else {
+        /* On equal data the left tail goes first, so the right tail stays last
+           unless it orders before the left one. */
+        ListNode* pTail = pJob->direction * pJob->compare(getData(getLastNode(pRight)),
+                                                          getData(getLastNode(pLeft))) < 0
+                          ? getLastNode(pLeft) : getLastNode(pRight);
+        setFirstNode(pLeft, mergeRuns(getFirstNode(pLeft), getFirstNode(pRight),
+                                      pJob->compare, pJob->direction, NULL));
+        setLastNode(pLeft, pTail);
+        pLeft->nodeCount += getSize(pRight);
+    }
+    *pRight = (LinkedList) {NULL, NULL, 0, pRight->pPool};
+}
+
+/**
+ * Sorts the LinkedList on the threads of the pool. Every thread sorts one
+ * segment with the merge sort of sortList, and the sorted segments are
+ * merged in pairs, with the pairs of each round merged in parallel. Like
+ * sortList, the sort is stable and allocates no Nodes.
+ * 
+ * @param pList A pointer to the LinkedList to be sorted.
+ * @param pPool A pointer to the ListThreadPool to run on.
+ * @param compare The function that orders two data values.
+ * @param order eAscending to follow the comparator, eDescending to reverse it.
+*/
+void parallelSortList(LinkedList* pList, ListThreadPool* pPool,
+                      int (*compare)(ListData* pA, ListData* pB), eSortOrder order){
+    int segmentCount = pPool->threadCount;
+    ListSegment* pSegments = (ListSegment*) trackedMalloc(segmentCount * sizeof(ListSegment));
+    if (pSegments == NULL)
+        OutofStorage();
+    ListJob job = {.pSegments = pSegments, .compare = compare,
+                   .direction = order == eDescending ? -1 : 1};
+
+    invalidateListIndex(pList);
+    splitListSegments(pList, pSegments, segmentCount);
+    runListTasks(pPool, sortSegmentTask, &job, segmentCount);
+    for (job.step = 1; job.step < segmentCount; job.step *= 2)
+        runListTasks(pPool, mergeSegmentTask, &job,
+                     (segmentCount - job.step + 2 * job.step - 1) / (2 * job.step));
+    joinListSegments(pList, pSegments, 1);
+    trackedFree(pSegments);
+}
+
+static void mapSegmentTask(void* pArg, int index){
+    ListJob* pJob = (ListJob*) pArg;
+    for (ListNode* pNode = getFirstNode(&pJob->pSegments[index].list); pNode != NULL;
+         pNode = pNode->pNext)
+        pJob->map(getData(pNode), pJob->pContext);
+}
+
+/**
+ * Calls map on the data of every Node, on the threads of the pool. The
+ * map function may be called for different Nodes at the same time.
+ * 
+ * @param pList A pointer to the LinkedList.
+ * @param pPool A pointer to the ListThreadPool to run on.
+ * @param map The function to call with the data of every Node.
+ * @param pContext Passed on to every call of map.
+*/
+void parallelMapList(LinkedList* pList, ListThreadPool* pPool,
+                     void (*map)(ListData* pData, void* pContext), void* pContext){
+    int segmentCount = pPool->threadCount;
+    ListSegment* pSegments = (ListSegment*) trackedMalloc(segmentCount * sizeof(ListSegment));
+    if (pSegments == NULL)
+        OutofStorage();
+    ListJob job = {.pSegments = pSegments, .map = map, .pContext = pContext};
+
+    splitListSegments(pList, pSegments, segmentCount);
+    runListTasks(pPool, mapSegmentTask, &job, segmentCount);
+    joinListSegments(pList, pSegments, segmentCount);
+    trackedFree(pSegments);
+}
+
+static void filterSegmentTask(void* pArg, int index){
+    ListJob* pJob = (ListJob*) pArg;
+    ListSegment* pSegment = &pJob->pSegments[index];
+    ListNode* pNode = getFirstNode(&pSegment->list);
+
+    pSegment->list = (LinkedList) {NULL, NULL, 0, pSegment->list.pPool};
+    while (pNode != NULL){
+        ListNode* pNext = pNode->pNext;
+        if (pJob->keep(getData(pNode), pJob->pContext)){
+            insertNodetoBack(&pSegment->list, pNode);
+        } else {
+            pNode->pNext = pSegment->pRemoved;
+            pSegment->pRemoved = pNode;
+        }
+        pNode = pNext;
+    }
+}
+
+/**
+ * Removes and deletes every Node whose data is rejected by keep. The
+ * Nodes are tested on the threads of the pool, and the rejected ones are
+ * deleted afterwards by the calling thread, since a NodePool can only be
+ * used by one thread at a time. The kept Nodes stay in their order.
+ * 
+ * @param pList A pointer to the LinkedList to be filtered.
+ * @param pPool A pointer to the ListThreadPool to run on.
+ * @param keep The function that returns true for the data to keep.
+ * @param pContext Passed on to every call of keep.
+ * @return The number of deleted Nodes.
+*/
+int parallelFilterList(LinkedList* pList, ListThreadPool* pPool,
+                       bool (*keep)(ListData* pData, void* pContext), void* pContext){
+    int segmentCount = pPool->threadCount;
+    ListSegment* pSegments = (ListSegment*) trackedMalloc(segmentCount * sizeof(ListSegment));
+    if (pSegments == NULL)
+        OutofStorage();
+    ListJob job = {.pSegments = pSegments, .keep = keep, .pContext = pContext};
+    int before = getSize(pList);
+
+    invalidateListIndex(pList);
+    splitListSegments(pList, pSegments, segmentCount);
+    runListTasks(pPool, filterSegmentTask, &job, segmentCount);
+    joinListSegments(pList, pSegments, segmentCount);
+
+    for (int s = 0; s < segmentCount; s++){
+        ListNode* pNode = pSegments[s].pRemoved;
+        while (pNode != NULL){
+            ListNode* pNext = pNode->pNext;
+            deleteNode(pNode);
+            pNode = pNext;
+        }
+    }
+    trackedFree(pSegments);
+    return before - getSize(pList);
+}
+
+static void reduceSegmentTask(void* pArg, int index){
+    ListSegment* pSegment = &((ListJob*) pArg)->pSegments[index];
+    ListNode* pNode = getFirstNode(&pSegment->list);
+    long long sum = 0;
+
+    if (pNode != NULL)
+        pSegment->min = pSegment->max = *getData(pNode);
+    for (; pNode != NULL; pNode = pNode->pNext){
+        ListData data = *getData(pNode);
+        sum += data;
+        if (data < pSegment->min)
+            pSegment->min = data;
+        if (data > pSegment->max)
+            pSegment->max = data;
+    }
+    pSegment->sum = sum;
+}
+
+/**
+ * Computes the sum, the smallest and the largest data of the LinkedList
+ * on the threads of the pool.
+ * 
+ * @param pList A pointer to the LinkedList.
+ * @param pPool A pointer to the ListThreadPool to run on.
+ * @param pResult Set to the combined result of every segment.
+*/
+static void reduceList(LinkedList* pList, ListThreadPool* pPool, ListSegment* pResult){
+    int segmentCount = pPool->threadCount;
+    ListSegment* pSegments = (ListSegment*) trackedMalloc(segmentCount * sizeof(ListSegment));
+    if (pSegments == NULL)
+        OutofStorage();
+    ListJob job = {.pSegments = pSegments};
+
+    splitListSegments(pList, pSegments, segmentCount);
+    runListTasks(pPool, reduceSegmentTask, &job, segmentCount);
+
+    pResult->sum = 0;
+    bool first = true;
+    for (int s = 0; s < segmentCount; s++){
+        ListSegment* pSegment = &pSegments[s];
+        if (isEmpty(&pSegment->list))
+            continue;
+        pResult->sum += pSegment->sum;
+        if (first || pSegment->min < pResult->min)
+            pResult->min = pSegment->min;
+        if (first || pSegment->max > pResult->max)
+            pResult->max = pSegment->max;
+        first = false;
+    }
+    joinListSegments(pList, pSegments, segmentCount);
+    trackedFree(pSegments);
+}
+
+/**
+ * Adds up the data of every Node on the threads of the pool.
+ * 
+ * @param pList A pointer to the LinkedList.
+ * @param pPool A pointer to the ListThreadPool to run on.
+ * @return The sum of the data, or 0 for an empty LinkedList.
+*/
+long long parallelSumList(LinkedList* pList, ListThreadPool* pPool){
+    ListSegment result;
+    reduceList(pList, pPool, &result);
+    return result.sum;
+}
+
+/**
+ * Finds the smallest data of the LinkedList on the threads of the pool.
+ * 
+ * @param pList A pointer to the LinkedList.
+ * @param pPool A pointer to the ListThreadPool to run on.
+ * @param pMin Set to the smallest data.
+ * @return false if the LinkedList is empty.
+*/
+bool parallelMinList(LinkedList* pList, ListThreadPool* pPool, ListData* pMin){
+    if (isEmpty(pList))
+        return false;
+    ListSegment result;
+    reduceList(pList, pPool, &result);
+    *pMin = result.min;
+    return true;
+}
+
+/**
+ * Finds the largest data of the LinkedList on the threads of the pool.
+ * 
+ * @param pList A pointer to the LinkedList.
+ * @param pPool A pointer to the ListThreadPool to run on.
+ * @param pMax Set to the largest data.
+ * @return false if the LinkedList is empty.
+*/
+bool parallelMaxList(LinkedList* pList, ListThreadPool* pPool, ListData* pMax){
+    if (isEmpty(pList))
+        return false;
+    ListSegment result;
+    reduceList(pList, pPool, &result);
+    *pMax = result.max;
+    return true;
+}
+
+/**
+ * Writes the data of the LinkedList to a file that openMappedList can map.
+ * 
+ * @param pList A pointer to the LinkedList to be saved.
+ * @param pPath The path of the file to write.
+ * @return false if the file could not be written.
+*/
+bool saveLinkedList(LinkedList* pList, const char* pPath){
+    FILE* pFile = fopen(pPath, "wb");
+    if (pFile == NULL)
+        return false;
+
+    MappedListHeader header = {{'L', 'I', 'S', 'T'}, MAPPED_LIST_VERSION,
+                               sizeof(ListData), getSize(pList)};
+    bool written = fwrite(&header, sizeof(header), 1, pFile) == 1;
+
+    for (ListNode* pNode = getFirstNode(pList); written && pNode != NULL; pNode = pNode->pNext)
+        written = fwrite(getData(pNode), sizeof(ListData), 1, pFile) == 1;
+    return fclose(pFile) == 0 && written;
+}
+
+/**
+ * Maps a file written by saveLinkedList read-only. The list can be read
+ * as soon as this returns: nothing is parsed or allocated, and the pages
+ * of the file are only read when they are first touched.
+ * 
+ * @param pMapped Set to the mapped list.
+ * @param pPath The path of the file.
+ * @return false if the file could not be mapped or is not a saved list.
+*/
+bool openMappedList(MappedList* pMapped, const char* pPath){
+    int fd = open(pPath, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t) info.st_size < sizeof(MappedListHeader)){
+        close(fd);
+        return false;
+    }
+
+    void* pBase = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (pBase == MAP_FAILED)
+        return false;
+
+    const MappedListHeader* pHeader = (const MappedListHeader*) pBase;
+    if (memcmp(pHeader->magic, "LIST", 4) != 0 || pHeader->version != MAPPED_LIST_VERSION
+        || pHeader->dataSize != sizeof(ListData)
+        || (size_t) info.st_size != sizeof(MappedListHeader)
+                                    + (size_t) pHeader->nodeCount * sizeof(ListData)){
+        munmap(pBase, info.st_size);
+        return false;
+    }
+
+    pMapped->pBase = pBase;
+    pMapped->size = info.st_size;
+    pMapped->pHeader = pHeader;
+    pMapped->pData = (const ListData*) (pHeader + 1);
+    return true;
+}
+
+/**
+ * Gets the number of Nodes in a mapped list.
+ * 
+ * @param pMapped A pointer to the mapped list.
+ * @return The number of Nodes.
+*/
+int getMappedListSize(MappedList* pMapped){
+    return (int) pMapped->pHeader->nodeCount;
+}
+
+/**
+ * Gets the data at the given position of a mapped list in constant time.
+ * 
+ * @param pMapped A pointer to the mapped list.
+ * @param pos The position of the data.
+ * @return A pointer to the data, or NULL if the position is outside the list.
+*/
+const ListData* getMappedListAt(MappedList* pMapped, int pos){
+    if (pos < 0 || pos >= getMappedListSize(pMapped))
+        return NULL;
+    return &pMapped->pData[pos];
+}
+
+/**
+ * Unmaps a list mapped by openMappedList.
+ * 
+ * @param pMapped A pointer to the mapped list.
+*/
+void closeMappedList(MappedList* pMapped){
+    munmap(pMapped->pBase, pMapped->size);
+    pMapped->pBase = NULL;
+    pMapped->pHeader = NULL;
+    pMapped->pData = NULL;
 }
 
 /**
@@ -327,13 +1809,14 @@ void printList(LinkedList* pList, void (*printData)(ListData* pData), bool dataF
 
 //----------------------------------------------------------
 //---------Specific to Testing------------------------------
+#ifndef LINKEDLIST_NO_MAIN
 
 void printInt(int* i){
     printf("%2d ", *i);
 }
 
 ListData* CreateData(ListData d){
-    ListData* pD = (ListData*) calloc(1, sizeof(ListData));
+    ListData* pD = (ListData*) trackedCalloc(1, sizeof(ListData));
     if (pD == NULL)
         OutofStorage();
     *pD = d;
@@ -351,7 +1834,14 @@ typedef enum{
     eDelete
 } eAction;
 
+void TestPrintOperation(LinkedList* pLL, eAction action,
+                        ListData data, eWhere where);
+void TestCreateNodeAndInsert(LinkedList* pLL, ListData data, eWhere where);
+ListData TestExamineNode(LinkedList* pLL, eWhere where);
+ListData TestRemoveNodeAndFree(LinkedList* pLL, eWhere where);
+
 int main(){
+    AllocStats before = getAllocStats();
     LinkedList* pLL = createLinkedList();
     printf( "Input or operation          "
             "Current state of linked list \n"
@@ -375,10 +1865,35 @@ int main(){
     }
     TestPrintOperation(pLL, eLook, 0, eBack);
 
+    const char* pPath = "list.map";
+    MappedList mapped;
+    if (!saveLinkedList(pLL, pPath) || !openMappedList(&mapped, pPath)){
+        fprintf(stderr, "Could not save and map the list\n");
+        return EXIT_FAILURE;
+    }
+    printf("\nMapped %d entries:", getMappedListSize(&mapped));
+    int pos = 0;
+    for (ListNode* pNode = getFirstNode(pLL); pNode != NULL; pNode = pNode->pNext, pos++){
+        const ListData* pData = getMappedListAt(&mapped, pos);
+        if (pData == NULL || *pData != *getData(pNode)){
+            fprintf(stderr, "\nThe mapped list differs from the saved one\n");
+            return EXIT_FAILURE;
+        }
+        printf(" %d", *pData);
+    }
+    printf("\n");
+    closeMappedList(&mapped);
+    remove(pPath);
+
     int count = pLL->nodeCount;
     for(int i = 0; i < count; i++){
         TestPrintOperation(pLL, eDelete, 0, eFront);
     }
+
+    destroyLinkedList(pLL);
+    if (!checkNoLeaks(stderr, "LinkedList demo", &before))
+        return EXIT_FAILURE;
+    return 0;
 }
 
 void TestPrintOperation(LinkedList* pLL, eAction action,
@@ -427,7 +1942,7 @@ ListData TestExamineNode(LinkedList* pLL, eWhere where){
             pNode = getNode(pLL, 0);
             break;
         case eBack:
-            pNode = getNode(pLL, getSize(pLL));
+            pNode = getLastNode(pLL);
             break;
     }
 
@@ -450,4 +1965,5 @@ ListData TestRemoveNodeAndFree(LinkedList* pLL, eWhere where){
     ListData data = *(getData(pNode));
     deleteNode(pNode);
     return data;
-}
\ No newline at end of file
+}
+#endif
@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include "TrackedAlloc.h"
 
 #define type int
 
@@ -15,15 +16,268 @@ typedef struct _Node ListNode;
 typedef struct _Node{
     type* data;
     ListNode* next;
+    int entry;          /* Its entry in the value index of the list, if any. */
 }ListNode;
 
+/* The value index keeps an entry for every node of the list: the node, the
+   node before it, which is NULL for the head, and its neighbours in the
+   chain of nodes that hold the same value. Entries that are not in use are
+   chained through nextSame. */
+typedef struct{
+    ListNode* node;
+    ListNode* previous;
+    int nextSame;
+    int prevSame;
+}IndexEntry;
+
+/* One slot of the value index per distinct value: the value, the number of
+   nodes holding it and the first entry of their chain. An empty slot has a
+   count of zero. */
+typedef struct{
+    type key;
+    int count;
+    int first;
+}IndexSlot;
+
+/* An open addressing hash table with linear probing over the distinct
+   values of a list. The capacity is a power of two, at most half of the
+   slots are used, and shift is 32 minus the base two logarithm of the
+   capacity. The entries never move, so a node finds its own entry in
+   constant time however many copies of its value the list holds. */
+typedef struct{
+    IndexSlot* slots;
+    int capacity;
+    int shift;
+    int count;
+    IndexEntry* entries;
+    int entryCapacity;
+    int entryCount;
+    int freeEntry;
+}ValueIndex;
+
 typedef struct _List{
     ListNode* head;
     int nodeCount;
+    ListNode* tail;
+    ValueIndex* index;
 }SinglyLinkedList;
 
 /**
- * Adds a node to the end of the Singly Linked List
+ * Hashes a value to its first slot in the value index. The multiplication
+ * mixes every bit of the value into the high bits of the product, so those
+ * are the ones kept.
+ * 
+ * Parameters:
+ * ValueIndex* index            The value index.
+ * type key                     The value.
+ * 
+ * Returns:
+ *      The slot the probe for the value starts at.
+*/
+static inline int indexSlot(ValueIndex* index, type key){
+    return (int) (((unsigned int) key * 2654435761u) >> index->shift);
+}
+
+/**
+ * Finds the slot of a value in the value index.
+ * 
+ * Parameters:
+ * ValueIndex* index            The value index.
+ * type key                     The value to look for.
+ * 
+ * Returns:
+ *      The position of the slot holding the value, or of the empty slot
+ *      the value would be placed in.
+*/
+static int probeIndex(ValueIndex* index, type key){
+    int i = indexSlot(index, key);
+
+    while (index->slots[i].count != 0 && index->slots[i].key != key)
+        i = (i + 1) & (index->capacity - 1);
+    return i;
+}
+
+/**
+ * Doubles the number of slots of the value index and places every value
+ * again. The entries are not touched.
+ * 
+ * Parameters:
+ * ValueIndex* index            The value index.
+*/
+static void growValueIndex(ValueIndex* index){
+    IndexSlot* old = index->slots;
+    int oldCapacity = index->capacity;
+
+    index->slots = (IndexSlot*) trackedCalloc(oldCapacity * 2, sizeof(IndexSlot));
+    if (index->slots == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###" "\n--- No Memory Available --- \n");
+        exit(EXIT_FAILURE);
+    }
+    index->capacity = oldCapacity * 2;
+    index->shift -= 1;
+
+    for (int i = 0; i < oldCapacity; i++)
+        if (old[i].count != 0)
+            index->slots[probeIndex(index, old[i].key)] = old[i];
+    trackedFree(old);
+}
+
+/**
+ * Takes an unused entry of the value index, growing the entries when all
+ * of them are in use.
+ * 
+ * Parameters:
+ * ValueIndex* index            The value index.
+ * 
+ * Returns:
+ *      The position of the entry.
+*/
+static int newIndexEntry(ValueIndex* index){
+    if (index->freeEntry >= 0){
+        int e = index->freeEntry;
+        index->freeEntry = index->entries[e].nextSame;
+        return e;
+    }
+
+    if (index->entryCount == index->entryCapacity){
+        IndexEntry* entries = (IndexEntry*) trackedRealloc(index->entries,
+                                  (size_t) index->entryCapacity * 2 * sizeof(IndexEntry));
+        if (entries == NULL){
+            fprintf(stderr, "### FATAL RUNTIME ERROR ###" "\n--- No Memory Available --- \n");
+            exit(EXIT_FAILURE);
+        }
+        index->entries = entries;
+        index->entryCapacity *= 2;
+    }
+    return index->entryCount++;
+}
+
+/**
+ * Adds a new node of the list to its value index, if it has one. The node
+ * goes to the front of the chain of its value.
+ * 
+ * Parameters:
+ * SinglyLinkedList* list       The list the node was linked into.
+ * ListNode* node               The new node.
+ * ListNode* previous           The node before it, or NULL for the head.
+*/
+static void indexNode(SinglyLinkedList* list, ListNode* node, ListNode* previous){
+    ValueIndex* index = list->index;
+    if (index == NULL)
+        return;
+
+    int e = newIndexEntry(index);
+    IndexEntry entry = {node, previous, -1, -1};
+    index->entries[e] = entry;
+    node->entry = e;
+
+    int i = probeIndex(index, *(node->data));
+    if (index->slots[i].count != 0){
+        index->entries[e].nextSame = index->slots[i].first;
+        index->entries[index->slots[i].first].prevSame = e;
+        index->slots[i].first = e;
+        index->slots[i].count += 1;
+        return;
+    }
+
+    if ((index->count + 1) * 2 > index->capacity){
+        growValueIndex(index);
+        i = probeIndex(index, *(node->data));
+    }
+    IndexSlot slot = {*(node->data), 1, e};
+    index->slots[i] = slot;
+    index->count += 1;
+}
+
+/**
+ * Empties a slot of the value index. The slots after it in the same run
+ * are moved back into the gap when their probe starts at or before it,
+ * so no probe stops early and no deleted markers are needed.
+ * 
+ * Parameters:
+ * ValueIndex* index            The value index.
+ * int i                        The position of the slot to empty.
+*/
+static void clearIndexSlot(ValueIndex* index, int i){
+    int mask = index->capacity - 1;
+    int j = i;
+
+    while (true){
+        index->slots[i].count = 0;
+        while (true){
+            j = (j + 1) & mask;
+            if (index->slots[j].count == 0){
+                index->count -= 1;
+                return;
+            }
+            int home = indexSlot(index, index->slots[j].key);
+            /* The slot at j may fill the gap unless its home lies in (i, j]. */
+            if (i <= j ? (home <= i || home > j) : (home <= i && home > j))
+                break;
+        }
+        index->slots[i] = index->slots[j];
+        i = j;
+    }
+}
+
+/**
+ * Takes a node out of the value index: its entry leaves the chain of its
+ * value, and the value leaves the index with its last node.
+ * 
+ * Parameters:
+ * ValueIndex* index            The value index.
+ * ListNode* node               The node to take out.
+*/
+static void unindexNode(ValueIndex* index, ListNode* node){
+    IndexEntry* entry = &index->entries[node->entry];
+    int i = probeIndex(index, *(node->data));
+
+    if (entry->prevSame >= 0)
+        index->entries[entry->prevSame].nextSame = entry->nextSame;
+    else
+        index->slots[i].first = entry->nextSame;
+    if (entry->nextSame >= 0)
+        index->entries[entry->nextSame].prevSame = entry->prevSame;
+
+    index->slots[i].count -= 1;
+    if (index->slots[i].count == 0)
+        clearIndexSlot(index, i);
+
+    entry->node = NULL;
+    entry->nextSame = index->freeEntry;
+    index->freeEntry = node->entry;
+}
+
+/**
+ * Unlinks a node from the list, keeps the value index in sync and frees
+ * the node together with its data.
+ * 
+ * Parameters:
+ * SinglyLinkedList* list       The list holding the node.
+ * ListNode* previous           The node before it, or NULL for the head.
+ * ListNode* current            The node to remove.
+*/
+static void unlinkNode(SinglyLinkedList* list, ListNode* previous, ListNode* current){
+    if (list->index != NULL){
+        unindexNode(list->index, current);
+        if (current->next != NULL)
+            list->index->entries[current->next->entry].previous = previous;
+    }
+
+    if (previous == NULL)
+        list->head = current->next;
+    else
+        previous->next = current->next;
+    if (current == list->tail)
+        list->tail = previous;
+    list->nodeCount -= 1;
+    trackedFree(current->data);
+    trackedFree(current);
+}
+
+/**
+ * Adds a node to the end of the Singly Linked List. The list keeps a
+ * pointer to its last node, so this returns in constant time.
  * 
  * Parameters:
  * SinglyLinkedList* list       The SinglyLinkedList to add the node.
@@ -31,8 +285,8 @@ typedef struct _List{
 */
 void addTailNode(SinglyLinkedList* list, type* data){
     ListNode* temp;
-    temp = (ListNode*) calloc(1, sizeof(ListNode));
-    type* tempData = (type*) calloc(1, sizeof(type));
+    temp = (ListNode*) trackedCalloc(1, sizeof(ListNode));
+    type* tempData = (type*) trackedCalloc(1, sizeof(type));
 
     *tempData = *data;
 
@@ -41,19 +295,59 @@ void addTailNode(SinglyLinkedList* list, type* data){
 
     if (list->head == NULL){
         list->head = temp;
+        list->tail = temp;
         list->nodeCount = 1;
+        indexNode(list, temp, NULL);
         return;
     }
 
-    ListNode* current = list->head;
-    int count = (list->nodeCount) - 1;
+    indexNode(list, temp, list->tail);
+    list->tail->next = temp;
+    list->tail = temp;
+    list->nodeCount += 1;
+}
 
-    for (int i = 0; i < count; i++){
-        current = current->next;
+/**
+ * Adds a batch of values to the end of the Singly Linked List. The new
+ * nodes are linked together in a single pass and then attached to the
+ * tail, so the cost is linear in the batch size only.
+ * 
+ * Parameters:
+ * SinglyLinkedList* list       The SinglyLinkedList to add the nodes.
+ * const type* data             The array of values to add.
+ * int n                        The number of values in the array.
+*/
+void appendArray(SinglyLinkedList* list, const type* data, int n){
+    if (n <= 0)
+        return;
+
+    ListNode* first = NULL;
+    ListNode* last = NULL;
+
+    for (int i = 0; i < n; i++){
+        ListNode* temp = (ListNode*) trackedCalloc(1, sizeof(ListNode));
+        type* tempData = (type*) trackedCalloc(1, sizeof(type));
+
+        *tempData = data[i];
+        temp->data = tempData;
+
+        if (first == NULL)
+            first = temp;
+        else
+            last->next = temp;
+        indexNode(list, temp, first != temp ? last : list->head != NULL ? list->tail : NULL);
+        last = temp;
     }
 
-    current->next = temp;
-    list->nodeCount += 1;
+    if (list->head == NULL){
+        list->head = first;
+        list->nodeCount = 0;
+    } else {
+        list->tail->next = first;
+    }
+
+    list->tail = last;
+    list->nodeCount += n;
 }
 
 /**
@@ -89,16 +383,24 @@ void printList(SinglyLinkedList* list){
 void addNewHead(SinglyLinkedList* list, type* data){
 
     ListNode* temp;
-    temp = (ListNode*) calloc(1, sizeof(ListNode));
-    type* tempData = (type*) calloc(1, sizeof(type));
+    temp = (ListNode*) trackedCalloc(1, sizeof(ListNode));
+    type* tempData = (type*) trackedCalloc(1, sizeof(type));
 
     *tempData = *data;
 
     temp->data = tempData;
     temp->next = list->head;
 
-    list->head= temp;
+    if (list->head == NULL){
+        list->tail = temp;
+        list->nodeCount = 0;
+    } else if (list->index != NULL){
+        list->index->entries[list->head->entry].previous = temp;
+    }
+    indexNode(list, temp, NULL);
 
+    list->head= temp;
+    list->nodeCount += 1;
 }
 
 /**
@@ -115,11 +417,32 @@ int getNodeCount(SinglyLinkedList* list){
     return list->nodeCount;
 }
 
+/**
+ * Removes the node holding the given data pointer from a list and frees
+ * the node together with its data. With a value index only the nodes
+ * holding the same value are searched instead of the whole list.
+ * 
+ * Parameters:
+ * SinglyLinkedList* list       The SinglyLinkedList to remove the node from.
+ * type* data                   The data pointer stored in the node.
+*/
 void removeNode(SinglyLinkedList* list, type* data){
-    ListNode* temp;
-    temp = (ListNode*) calloc(1, sizeof(ListNode));
-
     if (list->head != NULL){
+        if (list->index != NULL){
+            ValueIndex* index = list->index;
+            int i = probeIndex(index, *data);
+            int e = index->slots[i].count != 0 ? index->slots[i].first : -1;
+
+            while (e >= 0 && index->entries[e].node->data != data)
+                e = index->entries[e].nextSame;
+            if (e < 0){
+                printf("Error: Cannot remove the node. Data not found!\n");
+                return;
+            }
+            unlinkNode(list, index->entries[e].previous, index->entries[e].node);
+            return;
+        }
+
         ListNode* current = list->head;
         ListNode* previous = NULL;
 
@@ -133,16 +456,154 @@ void removeNode(SinglyLinkedList* list, type* data){
             }
         }
 
-        if (previous == NULL){
-           list->head = list->head->next;
-           free(current);
-           return; 
-        }
-
-        previous->next = current->next;
-        free(current);
+        unlinkNode(list, previous, current);
 
     } else {
        printf("Empty list!\n");
     }
 }
+
+/**
+ * Builds a value index for a list, so that containsValue and removeValue
+ * take constant time on average instead of walking the list, and
+ * removeNode only searches the nodes holding the same value.
+ * The index is kept in sync by addTailNode, appendArray, addNewHead and
+ * removeNode until deleteValueIndex or destroyList frees it.
+ * 
+ * Parameters:
+ * SinglyLinkedList* list       The SinglyLinkedList to index.
+*/
+void createValueIndex(SinglyLinkedList* list){
+    if (list->index != NULL)
+        return;
+
+    int capacity = 16;
+    int shift = 28;
+    while (capacity < list->nodeCount * 2){
+        capacity *= 2;
+        shift -= 1;
+    }
+    int entryCapacity = list->nodeCount > 16 ? list->nodeCount : 16;
+
+    ValueIndex* index = (ValueIndex*) trackedCalloc(1, sizeof(ValueIndex));
+    IndexSlot* slots = (IndexSlot*) trackedCalloc(capacity, sizeof(IndexSlot));
+    IndexEntry* entries = (IndexEntry*) trackedMalloc((size_t) entryCapacity * sizeof(IndexEntry));
+    if (index == NULL || slots == NULL || entries == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###" "\n--- No Memory Available --- \n");
+        exit(EXIT_FAILURE);
+    }
+    index->slots = slots;
+    index->capacity = capacity;
+    index->shift = shift;
+    index->entries = entries;
+    index->entryCapacity = entryCapacity;
+    index->freeEntry = -1;
+    list->index = index;
+
+    ListNode* previous = NULL;
+    for (ListNode* current = list->head; current != NULL; current = current->next){
+        indexNode(list, current, previous);
+        previous = current;
+    }
+}
+
+/**
+ * Frees the value index of a list. The list itself is not changed.
+ * 
+ * Parameters:
+ * SinglyLinkedList* list       The SinglyLinkedList whose index to free.
+*/
+void deleteValueIndex(SinglyLinkedList* list){
+    if (list->index == NULL)
+        return;
+
+    trackedFree(list->index->slots);
+    trackedFree(list->index->entries);
+    trackedFree(list->index);
+    list->index = NULL;
+}
+
+/**
+ * Checks whether a list holds a value. This walks the list unless it has
+ * a value index.
+ * 
+ * Parameters:
+ * SinglyLinkedList* list       The SinglyLinkedList to search.
+ * type* data                   The value to look for.
+ * 
+ * Returns:
+ *      true if a node of the list holds the value.
+*/
+bool containsValue(SinglyLinkedList* list, type* data){
+    ValueIndex* index = list->index;
+
+    if (index == NULL){
+        for (ListNode* current = list->head; current != NULL; current = current->next)
+            if (*(current->data) == *data)
+                return true;
+        return false;
+    }
+
+    return index->slots[probeIndex(index, *data)].count != 0;
+}
+
+/**
+ * Removes one node holding a value from a list and frees it together with
+ * its data. When the value occurs more than once, which of its nodes is
+ * removed is not specified. This walks the list unless it has a value
+ * index.
+ * 
+ * Parameters:
+ * SinglyLinkedList* list       The SinglyLinkedList to remove the value from.
+ * type* data                   The value to remove.
+ * 
+ * Returns:
+ *      true if a node was removed, false if the list does not hold the value.
+*/
+bool removeValue(SinglyLinkedList* list, type* data){
+    ValueIndex* index = list->index;
+
+    if (index == NULL){
+        ListNode* previous = NULL;
+        for (ListNode* current = list->head; current != NULL; current = current->next){
+            if (*(current->data) == *data){
+                unlinkNode(list, previous, current);
+                return true;
+            }
+            previous = current;
+        }
+        return false;
+    }
+
+    int i = probeIndex(index, *data);
+    if (index->slots[i].count == 0)
+        return false;
+
+    IndexEntry* entry = &index->entries[index->slots[i].first];
+    unlinkNode(list, entry->previous, entry->node);
+    return true;
+}
+
+/**
+ * Frees every node of a list together with its data, and its value index
+ * if it has one, and leaves the list empty, so it can be reused or
+ * discarded.
+ * 
+ * Parameters:
+ * SinglyLinkedList* list       The SinglyLinkedList to empty.
+*/
+void destroyList(SinglyLinkedList* list){
+    ListNode* current = list->head;
+
+    while (current != NULL){
+        ListNode* next = current->next;
+        trackedFree(current->data);
+        trackedFree(current);
+        current = next;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->nodeCount = 0;
+    deleteValueIndex(list);
+}
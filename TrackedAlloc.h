@@ -0,0 +1,230 @@
+/**
+ * Allocation tracking Header File
+ *
+ * Every container allocates and frees its memory through the functions
+ * in this file. Without TRACK_ALLOCATIONS they are plain malloc, calloc,
+ * realloc, aligned_alloc and free, so the tracking costs nothing. Built
+ * with -DTRACK_ALLOCATIONS, each block carries a small header holding its
+ * size, and the process keeps counts of live bytes, peak bytes and
+ * allocator calls. A scenario takes a snapshot with getAllocStats before
+ * it starts and checks it with checkNoLeaks when it is done.
+ *
+ * @note With tracking on, memory handed to a container that the container
+ * later frees, such as the data of createNode, must come from
+ * trackedMalloc or trackedCalloc.
+ *
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#ifndef TRACKED_ALLOC_H
+#define TRACKED_ALLOC_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+typedef struct{
+    long long liveBytes;
+    long long peakBytes;
+    long long allocations;
+    long long frees;
+    long long allocatedBytes;
+} AllocStats;
+
+#ifdef TRACK_ALLOCATIONS
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Sits right before every tracked block. offset is the distance from the
+   start of the underlying allocation to the block. */
+typedef union{
+    struct{
+        size_t size;
+        size_t offset;
+    } info;
+    max_align_t align;
+} AllocHeader;
+
+static atomic_llong trackedLiveBytes;
+static atomic_llong trackedPeakBytes;
+static atomic_llong trackedAllocations;
+static atomic_llong trackedFrees;
+static atomic_llong trackedAllocatedBytes;
+
+/**
+ * Adds a block of the given size to the counters.
+ *
+ * @param size The size of the block in bytes.
+*/
+static inline void countAllocation(size_t size){
+    long long live = atomic_fetch_add(&trackedLiveBytes, (long long) size) + (long long) size;
+    long long peak = atomic_load(&trackedPeakBytes);
+    while (live > peak && !atomic_compare_exchange_weak(&trackedPeakBytes, &peak, live))
+        ;
+    atomic_fetch_add(&trackedAllocations, 1);
+    atomic_fetch_add(&trackedAllocatedBytes, (long long) size);
+}
+
+/**
+ * Writes the header of a new block and counts it.
+ *
+ * @param pBase The underlying allocation, or NULL if it failed.
+ * @param offset The distance from pBase to the block.
+ * @param size The size of the block requested by the caller.
+ * @return A pointer to the block, or NULL if pBase is NULL.
+*/
+static inline void* startTrackedBlock(char* pBase, size_t offset, size_t size){
+    if (pBase == NULL)
+        return NULL;
+    AllocHeader* pHeader = (AllocHeader*) (pBase + offset) - 1;
+    pHeader->info.size = size;
+    pHeader->info.offset = offset;
+    countAllocation(size);
+    return pBase + offset;
+}
+
+static inline void* trackedMalloc(size_t size){
+    return startTrackedBlock((char*) malloc(sizeof(AllocHeader) + size),
+                             sizeof(AllocHeader), size);
+}
+
+static inline void* trackedCalloc(size_t count, size_t size){
+    if (size != 0 && count > (SIZE_MAX - sizeof(AllocHeader)) / size)
+        return NULL;
+    return startTrackedBlock((char*) calloc(1, sizeof(AllocHeader) + count * size),
+                             sizeof(AllocHeader), count * size);
+}
+
+/**
+ * Allocates a block aligned to the given power of two. The header is
+ * placed in front of the block inside the padding of one alignment unit.
+ *
+ * @param alignment The alignment in bytes.
+ * @param size The size of the block, a multiple of alignment.
+ * @return A pointer to the block, or NULL if no memory is available.
+*/
+static inline void* trackedAlignedAlloc(size_t alignment, size_t size){
+    size_t offset = (sizeof(AllocHeader) + alignment - 1) / alignment * alignment;
+    return startTrackedBlock((char*) aligned_alloc(alignment, offset + size), offset, size);
+}
+
+static inline void trackedFree(void* p){
+    if (p == NULL)
+        return;
+    AllocHeader* pHeader = (AllocHeader*) p - 1;
+    atomic_fetch_sub(&trackedLiveBytes, (long long) pHeader->info.size);
+    atomic_fetch_add(&trackedFrees, 1);
+    free((char*) p - pHeader->info.offset);
+}
+
+/**
+ * Resizes a block from trackedMalloc or trackedCalloc. It is counted as
+ * one allocation and one free, so the number of live blocks stays right.
+ *
+ * @param p The block to resize, or NULL to allocate a new one.
+ * @param size The new size in bytes.
+ * @return A pointer to the resized block, or NULL if no memory is available.
+*/
+static inline void* trackedRealloc(void* p, size_t size){
+    if (p == NULL)
+        return trackedMalloc(size);
+    size_t oldSize = ((AllocHeader*) p - 1)->info.size;
+    char* pBase = (char*) realloc((char*) p - sizeof(AllocHeader), sizeof(AllocHeader) + size);
+    if (pBase == NULL)
+        return NULL;
+    atomic_fetch_sub(&trackedLiveBytes, (long long) oldSize);
+    atomic_fetch_add(&trackedFrees, 1);
+    return startTrackedBlock(pBase, sizeof(AllocHeader), size);
+}
+
+/**
+ * Gets a snapshot of the allocation counters of the process.
+ *
+ * @return The counters.
+*/
+static inline AllocStats getAllocStats(void){
+    AllocStats stats = {atomic_load(&trackedLiveBytes), atomic_load(&trackedPeakBytes),
+                        atomic_load(&trackedAllocations), atomic_load(&trackedFrees),
+                        atomic_load(&trackedAllocatedBytes)};
+    return stats;
+}
+
+/**
+ * Lowers the peak to the current live bytes, so the peak of the next
+ * scenario can be measured on its own.
+*/
+static inline void resetAllocPeak(void){
+    atomic_store(&trackedPeakBytes, atomic_load(&trackedLiveBytes));
+}
+
+#else
+#define trackedMalloc(size) malloc(size)
+#define trackedCalloc(count, size) calloc(count, size)
+#define trackedRealloc(p, size) realloc(p, size)
+#define trackedAlignedAlloc(alignment, size) aligned_alloc(alignment, size)
+#define trackedFree(p) free(p)
+
+static inline AllocStats getAllocStats(void){
+    AllocStats stats = {0, 0, 0, 0, 0};
+    return stats;
+}
+
+static inline void resetAllocPeak(void){
+}
+#endif
+
+/**
+ * Prints the allocation counters of the process.
+ *
+ * @param pFile The stream to print to.
+ * @param pLabel A name printed in front of the counters.
+*/
+static inline void printAllocStats(FILE* pFile, const char* pLabel){
+    AllocStats stats = getAllocStats();
+    fprintf(pFile, "%-28s live %lld B, peak %lld B, %lld allocations, %lld frees\n",
+            pLabel, stats.liveBytes, stats.peakBytes, stats.allocations, stats.frees);
+}
+
+/**
+ * Prints how much an operation allocated on average since a snapshot.
+ *
+ * @param pFile The stream to print to.
+ * @param pOperation The name of the operation.
+ * @param pBefore The snapshot taken before the operations ran.
+ * @param ops The number of operations that ran.
+*/
+static inline void printAllocRate(FILE* pFile, const char* pOperation,
+                                  const AllocStats* pBefore, long long ops){
+    AllocStats stats = getAllocStats();
+    double n = ops > 0 ? (double) ops : 1.0;
+    fprintf(pFile, "%-28s %8.3f allocs/op %10.1f B/op %8.3f frees/op, peak %lld B\n",
+            pOperation, (stats.allocations - pBefore->allocations) / n,
+            (stats.allocatedBytes - pBefore->allocatedBytes) / n,
+            (stats.frees - pBefore->frees) / n, stats.peakBytes);
+}
+
+/**
+ * Checks that a scenario freed everything it allocated, and prints the
+ * leak if it did not. Without TRACK_ALLOCATIONS nothing is counted and
+ * the check always passes.
+ *
+ * @param pFile The stream to print to.
+ * @param pScenario The name of the scenario.
+ * @param pBefore The snapshot taken before the scenario started.
+ * @return true if no bytes leaked.
+*/
+static inline bool checkNoLeaks(FILE* pFile, const char* pScenario, const AllocStats* pBefore){
+    AllocStats stats = getAllocStats();
+    long long leakedBytes = stats.liveBytes - pBefore->liveBytes;
+    long long leakedBlocks = (stats.allocations - pBefore->allocations)
+                             - (stats.frees - pBefore->frees);
+
+    if (leakedBytes == 0 && leakedBlocks == 0)
+        return true;
+    fprintf(pFile, "%s leaked %lld bytes in %lld blocks\n", pScenario, leakedBytes, leakedBlocks);
+    return false;
+}
+
+#endif
@@ -1,7 +1,19 @@
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdatomic.h>
+#include <sched.h>
+#include "TrackedAlloc.h"
+#include "OperationStats.h"
 
 /**
  * A Tree structure based on the Cory Althoff's Self-Taught
@@ -13,22 +25,219 @@
 typedef int TreeData, NodeData;
 typedef struct _node Node;
 
+/* The weight of a Node is the sum of the counts in its subtree, which
+   lets rank, select and percentile skip whole subtrees. */
 typedef struct _node{
     NodeData* data;
     Node* leftChild;
     Node* rightChild;
     int count;
+    int height;
+    long long weight;
 } Node;
 
 typedef struct{
     Node* root;
     int height;
+    bool balanced;
+    Node** path;
+    int pathCapacity;
+    char* pBlock;
+    size_t blockSize;
 }Tree;
 
+typedef struct{
+    Node** stack;
+    int top;
+    int capacity;
+}TreeIterator;
+
+#define LOAD_BUFFER_SIZE (1 << 20)
+#define LOAD_BATCH_SIZE (1 << 16)
+
+/* The amount of input consumed by loadTreeFromFd. Integers that do not
+   fit in TreeData are rejected rather than loaded. */
+typedef struct{
+    long long bytes;
+    long long keys;
+    long long rejected;
+}TreeLoadStats;
+
+#define MAPPED_TREE_VERSION 1
+
+/* The file written by saveTree is a header followed by the Nodes in level
+   order. A child is stored as its index in the Node array instead of a
+   pointer, so the file can be mapped at any address and used as it is. */
+typedef struct{
+    char magic[4];
+    uint32_t version;
+    uint32_t nodeSize;
+    uint32_t nodeCount;
+    int32_t root;
+    int32_t height;
+}MappedTreeHeader;
+
+typedef struct{
+    TreeData data;
+    int32_t count;
+    int32_t left;
+    int32_t right;
+}MappedTreeNode;
+
+typedef struct{
+    void* pBase;
+    size_t size;
+    const MappedTreeHeader* pHeader;
+    const MappedTreeNode* pNodes;
+}MappedTree;
+
+#define ARENA_NONE 0
+/* An AVL tree of 2^32 Nodes is less than 47 levels high. */
+#define ARENA_MAX_HEIGHT 64
+
+/* A Node of an ArenaTree. The key and its count are stored inline, and
+   the children are indices into the Node array of the Tree. */
+typedef struct{
+    TreeData data;
+    int32_t count;
+    uint32_t left;
+    uint32_t right;
+}ArenaNode;
+
+_Static_assert(sizeof(ArenaNode) == 16, "ArenaNode must be 16 bytes");
+
+/* A balanced Tree whose Nodes live in one growable array. The heights are
+   kept in a second array in the same allocation, since only insertion and
+   removal read them. Slot 0 stands for a missing child and has height 0.
+   Removed Nodes are chained through their left index for reuse. */
+typedef struct{
+    ArenaNode* pNodes;
+    uint8_t* pHeights;
+    uint32_t capacity;
+    uint32_t used;
+    uint32_t freeList;
+    uint32_t root;
+    int size;
+}ArenaTree;
+
+typedef struct _concurrentNode ConcurrentNode;
+
+/* A Node of a ConcurrentTree. The key never changes once the Node is
+   linked. The version has a lock bit, a bit that is set while a rotation
+   moves the Node down, and a counter of those rotations above them. The
+   height and the pending link are only used by the thread that
+   rebalances. */
+typedef struct _concurrentNode{
+    TreeData data;
+    atomic_int count;
+    _Atomic(ConcurrentNode*) leftChild;
+    _Atomic(ConcurrentNode*) rightChild;
+    atomic_uint version;
+    int height;
+    ConcurrentNode* pNextPending;
+}ConcurrentNode;
+
+/* An AVL Tree that many threads can read and write at once. Finds, erases
+   and inserts of a key that is already there take no lock. A new key is
+   linked under the lock of its parent Node only. Leaves that may have
+   made the Tree higher are pushed on the pending list and retraced by one
+   thread at a time, which locks only the Nodes each rotation changes.
+   Searches check the versions of the Nodes they pass, in the style of an
+   optimistic AVL Tree, and start over if a rotation moved one of them
+   down. Erasing the last copy of a key leaves its Node in place with a
+   count of zero, so a reader never meets a Node that is being freed. */
+typedef struct{
+    _Atomic(ConcurrentNode*) root;
+    _Atomic(ConcurrentNode*) pending;
+    atomic_bool rebalancing;
+    ConcurrentNode** pPath;
+    int pathCapacity;
+}ConcurrentTree;
+
+#define CONCURRENT_LOCKED 1u
+#define CONCURRENT_SHRINKING 2u
+#define CONCURRENT_CHANGE 4u
+#define CONCURRENT_PATH_SIZE 64
+
+#define PERSISTENT_MAX_HEIGHT 64
+
+typedef struct _persistentNode PersistentNode;
+
+/* A Node of a PersistentTree. refs counts the links to the Node from
+   other Nodes and from versions. A Node with more than one link may be
+   seen by another version and is never changed; it is copied instead. */
+typedef struct _persistentNode{
+    TreeData data;
+    int count;
+    int height;
+    atomic_int refs;
+    PersistentNode* leftChild;
+    PersistentNode* rightChild;
+}PersistentNode;
+
+/* One version of a persistent balanced Tree. Versions share every Node
+   that neither has changed since the snapshot that split them. */
+typedef struct{
+    PersistentNode* root;
+    int size;
+    long long total;
+}PersistentTree;
+
 /* Prototypes:
 Tree* createTree();
+Tree* createBalancedTree();
 int getHeight(Tree* pTree);
-void insert(Node* pNode);
+void insert(TreeData* pData, Tree* pTree);
+void insertSortedBatch(const TreeData* pKeys, int n, Tree* pTree);
+bool loadTreeFromFd(Tree* pTree, int fd, TreeLoadStats* pStats);
+bool erase(TreeData* pData, Tree* pTree);
+void destroyTree(Tree* pTree);
+Tree* buildTreeFromArray(const TreeData* pData, int n);
+Node* find(TreeData* pData, Tree* pTree);
+Node* lowerBound(TreeData* pData, Tree* pTree);
+Node* upperBound(TreeData* pData, Tree* pTree);
+long long getTotalCount(Tree* pTree);
+long long getRank(TreeData* pData, Tree* pTree);
+Node* selectNode(long long k, Tree* pTree);
+Node* percentile(double p, Tree* pTree);
+void rangeQuery(Tree* pTree, TreeData* pLow, TreeData* pHigh,
+                void (*visit)(Node* pNode, void* pContext), void* pContext);
+TreeIterator* createTreeIterator(Tree* pTree);
+void seekTreeIterator(TreeIterator* pIter, Tree* pTree, TreeData* pData);
+bool hasNext(TreeIterator* pIter);
+Node* nextNode(TreeIterator* pIter);
+void deleteTreeIterator(TreeIterator* pIter);
+bool saveTree(Tree* pTree, const char* pPath);
+bool openMappedTree(MappedTree* pMapped, const char* pPath);
+int getMappedTreeSize(MappedTree* pMapped);
+const MappedTreeNode* findMappedTree(TreeData* pData, MappedTree* pMapped);
+void closeMappedTree(MappedTree* pMapped);
+ArenaTree* createArenaTree(int capacity);
+void insertArena(TreeData* pData, ArenaTree* pTree);
+bool eraseArena(TreeData* pData, ArenaTree* pTree);
+ArenaNode* findArena(TreeData* pData, ArenaTree* pTree);
+void visitArena(ArenaTree* pTree, void (*visit)(ArenaNode* pNode, void* pContext), void* pContext);
+int getArenaSize(ArenaTree* pTree);
+int getArenaHeight(ArenaTree* pTree);
+size_t getArenaMemory(ArenaTree* pTree);
+void destroyArenaTree(ArenaTree* pTree);
+ConcurrentTree* createConcurrentTree();
+void insertConcurrent(TreeData* pData, ConcurrentTree* pTree);
+bool eraseConcurrent(TreeData* pData, ConcurrentTree* pTree);
+int findConcurrent(TreeData* pData, ConcurrentTree* pTree);
+int rebuildConcurrentTree(ConcurrentTree* pTree);
+void destroyConcurrentTree(ConcurrentTree* pTree);
+PersistentTree* createPersistentTree();
+PersistentTree* snapshotPersistentTree(PersistentTree* pTree);
+void insertPersistent(TreeData* pData, PersistentTree* pTree);
+bool erasePersistent(TreeData* pData, PersistentTree* pTree);
+const PersistentNode* findPersistent(TreeData* pData, PersistentTree* pTree);
+void visitPersistent(PersistentTree* pTree,
+                     void (*visit)(const PersistentNode* pNode, void* pContext), void* pContext);
+int getPersistentSize(PersistentTree* pTree);
+long long getPersistentTotal(PersistentTree* pTree);
+int getPersistentHeight(PersistentTree* pTree);
+void releasePersistentTree(PersistentTree* pTree);
 Node* getLeftChild(Node* pNode);
 Node* getRightChild(Node* pNode);
 
@@ -42,20 +251,45 @@ void insertRight(Node* pNode);
 insertNodeUsingComparator
 */
 
+/**
+ * This function only prints a message to the stderr.
+*/
+void OutofStorage(void){
+    fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+    "\n--- No Memory Available --- \n");
+    exit(EXIT_FAILURE);
+}
+
 /**
  * Creates a new instance of a Tree structure.
  * 
  * @return A pointer to the root of the new Tree.
 */
 Tree* createTree(){
-    Tree* temp = (Tree*) calloc(1, sizeof(Tree));
+    Tree* temp = (Tree*) trackedCalloc(1, sizeof(Tree));
+    if (temp == NULL)
+        OutofStorage();
     temp->height = 0;
     temp->root = NULL;
     return temp;
 }
 
 /**
- * Gets the height of the Tree.
+ * Creates a new instance of a self-balancing (AVL) Tree structure. The
+ * heights of the two subtrees of any Node never differ by more than one,
+ * so sorted input no longer degrades the Tree into a list.
+ * 
+ * @return A pointer to the root of the new Tree.
+*/
+Tree* createBalancedTree(){
+    Tree* temp = createTree();
+    temp->balanced = true;
+    return temp;
+}
+
+/**
+ * Gets the height of the Tree, which is the number of Nodes on the
+ * longest path from the root to a leaf. An empty Tree has height 0.
  * 
  * @return The height of the Tree.
 */
@@ -71,13 +305,17 @@ int getHeight(Tree* pTree){
  * @return A pointer to the new Node.
 */
 Node* createNode(NodeData* pData){
-    Node* temp = (Node*) calloc(1, sizeof(Node));
-    NodeData* data = (NodeData*) calloc(1, sizeof(NodeData));
+    Node* temp = (Node*) trackedCalloc(1, sizeof(Node));
+    NodeData* data = (NodeData*) trackedCalloc(1, sizeof(NodeData));
+    if (temp == NULL || data == NULL)
+        OutofStorage();
     *data = *pData;
     temp->data = data;
     temp->leftChild = NULL;
     temp->rightChild = NULL;
     temp->count = 1;
+    temp->height = 1;
+    temp->weight = 1;
     return temp;
 }
 
@@ -131,12 +369,200 @@ void setRoot(Node* pNode, Tree* pTree){
     pTree->root = pNode;
 }
 
+/**
+ * Gets the height of the subtree rooted at the Node.
+ * 
+ * @param pNode The root Node of the subtree, or NULL.
+ * @return The height of the subtree.
+*/
+int getNodeHeight(Node* pNode){
+    return pNode == NULL ? 0 : pNode->height;
+}
+
+/**
+ * Recomputes the height of the Node from the heights of its children.
+ * 
+ * @param pNode The Node to be updated.
+*/
+void updateHeight(Node* pNode){
+    int left = getNodeHeight(getLeftChild(pNode));
+    int right = getNodeHeight(getRightChild(pNode));
+    pNode->height = (left > right ? left : right) + 1;
+}
+
+/**
+ * Gets the weight of the subtree rooted at the Node.
+ * 
+ * @param pNode The root Node of the subtree, or NULL.
+ * @return The sum of the counts in the subtree.
+*/
+long long getNodeWeight(Node* pNode){
+    return pNode == NULL ? 0 : pNode->weight;
+}
+
+/**
+ * Recomputes the weight of the Node from its count and the weights of its
+ * children.
+ * 
+ * @param pNode The Node to be updated.
+*/
+void updateWeight(Node* pNode){
+    pNode->weight = pNode->count + getNodeWeight(getLeftChild(pNode))
+                    + getNodeWeight(getRightChild(pNode));
+}
+
+/**
+ * Rotates the subtree to the left, so the right child becomes its root.
+ * 
+ * @param pNode The root Node of the subtree.
+ * @return The new root Node of the subtree.
+*/
+Node* rotateLeft(Node* pNode){
+    Node* pRight = getRightChild(pNode);
+    setRightChild(getLeftChild(pRight), pNode);
+    setLeftChild(pNode, pRight);
+    updateHeight(pNode);
+    updateHeight(pRight);
+    updateWeight(pNode);
+    updateWeight(pRight);
+    return pRight;
+}
+
+/**
+ * Rotates the subtree to the right, so the left child becomes its root.
+ * 
+ * @param pNode The root Node of the subtree.
+ * @return The new root Node of the subtree.
+*/
+Node* rotateRight(Node* pNode){
+    Node* pLeft = getLeftChild(pNode);
+    setLeftChild(getRightChild(pLeft), pNode);
+    setRightChild(pNode, pLeft);
+    updateHeight(pNode);
+    updateHeight(pLeft);
+    updateWeight(pNode);
+    updateWeight(pLeft);
+    return pLeft;
+}
+
+/**
+ * Restores the AVL property of a subtree whose children differ in height
+ * by at most two.
+ * 
+ * @param pNode The root Node of the subtree.
+ * @return The new root Node of the subtree.
+*/
+Node* rebalance(Node* pNode){
+    Node* pLeft = getLeftChild(pNode);
+    Node* pRight = getRightChild(pNode);
+    int balance = getNodeHeight(pLeft) - getNodeHeight(pRight);
+
+    if (balance > 1){
+        if (getNodeHeight(getLeftChild(pLeft)) < getNodeHeight(getRightChild(pLeft)))
+            setLeftChild(rotateLeft(pLeft), pNode);
+        return rotateRight(pNode);
+    }
+    if (balance < -1){
+        if (getNodeHeight(getRightChild(pRight)) < getNodeHeight(getLeftChild(pRight)))
+            setRightChild(rotateRight(pRight), pNode);
+        return rotateLeft(pNode);
+    }
+    return pNode;
+}
+
+/**
+ * Replaces a child of the parent Node, or the root of the Tree when
+ * there is no parent.
+ * 
+ * @param pTree The Tree that contains the Nodes.
+ * @param pParent The parent Node, or NULL for the root.
+ * @param pOld The child to be replaced.
+ * @param pNew The Node to take its place.
+*/
+void replaceChild(Tree* pTree, Node* pParent, Node* pOld, Node* pNew){
+    if (pParent == NULL)
+        setRoot(pNew, pTree);
+    else if (getLeftChild(pParent) == pOld)
+        setLeftChild(pNew, pParent);
+    else
+        setRightChild(pNew, pParent);
+}
+
+/**
+ * Records a Node on the search path of the Tree, growing the path buffer
+ * when needed.
+ * 
+ * @param pTree The Tree being searched.
+ * @param pNode The Node visited.
+ * @param depth The depth of the Node on the path.
+*/
+void pushPath(Tree* pTree, Node* pNode, int depth){
+    if (depth == pTree->pathCapacity){
+        int capacity = pTree->pathCapacity == 0 ? 64 : pTree->pathCapacity * 2;
+        Node** path = (Node**) trackedRealloc(pTree->path, capacity * sizeof(Node*));
+        if (path == NULL)
+            OutofStorage();
+        pTree->path = path;
+        pTree->pathCapacity = capacity;
+    }
+    pTree->path[depth] = pNode;
+}
+
+/**
+ * Walks the recorded search path back towards the root, updating heights
+ * and, for a balanced Tree, rotating unbalanced subtrees. The walk stops
+ * as soon as a subtree keeps its height, since nothing above it changes.
+ * 
+ * The weights on the path must be up to date before a rotation reads
+ * them. A caller that defers weight changes passes them in pPending,
+ * where pPending[d] is still to be added to the Node at depth d and every
+ * Node above it. The walk adds them to the Nodes it passes, and moves
+ * what is left to the depth above the one it stops at.
+ * 
+ * @param pTree The Tree that was modified.
+ * @param depth The number of Nodes on the recorded path.
+ * @param pPending The deferred weight changes by depth, or NULL if there are none.
+ * @return The depth of the highest rotated Node, or depth if nothing was
+ * rotated. The recorded path above that depth is still valid.
+*/
+int retrace(Tree* pTree, int depth, long long* pPending){
+    int rotated = depth;
+    long long carry = 0;
+
+    for (int i = depth - 1; i >= 0; i--){
+        Node* pNode = pTree->path[i];
+        int oldHeight = pNode->height;
+
+        if (pPending != NULL){
+            carry += pPending[i];
+            pPending[i] = 0;
+            pNode->weight += carry;
+        }
+        updateHeight(pNode);
+        Node* pSubRoot = pTree->balanced ? rebalance(pNode) : pNode;
+
+        if (pSubRoot != pNode){
+            replaceChild(pTree, i > 0 ? pTree->path[i - 1] : NULL, pNode, pSubRoot);
+            rotated = i;
+        } else if (pNode->height == oldHeight){
+            if (pPending != NULL && i > 0)
+                pPending[i - 1] += carry;
+            break;
+        }
+    }
+    pTree->height = getNodeHeight(pTree->root);
+    return rotated;
+}
+
 /**
  * Insert data to the Tree using following conditions,
  * - If data > parent, inserts to right
  * - If data < parent, inserts to left
  * - If data = parent, increase the count
  * 
+ * A balanced Tree is rebalanced on the way back up, and the height of the
+ * Tree is kept up to date in both modes.
+ * 
  * @note This method inserts another copy of the data. So, the function
  * does not change the data in any means.
  * 
@@ -144,44 +570,2255 @@ void setRoot(Node* pNode, Tree* pTree){
  * @param pTree A pointer to the Tree which the data to be added.
 */
 void insert(TreeData* pData, Tree* pTree){
-    Node* temp = createNode(pData);
-
+    STATS_START(start);
     Node* root = pTree->root;
+    int depth = 0;
 
     if(root == NULL){
-        setRoot(temp, pTree);
+        setRoot(createNode(pData), pTree);
+        pTree->height = 1;
+        STATS_RECORD(eStatsTreeInsert, start, 0, false);
         return;
     }
     
     while (true){
+        pushPath(pTree, root, depth++);
+        root->weight++;
         if (*(root->data) > *pData){
             if (getLeftChild(root) != NULL)
                 root = getLeftChild(root);
             else{
-                setLeftChild(temp, root);
-                return;
+                setLeftChild(createNode(pData), root);
+                break;
             }
         } else if (*(root->data) < *pData){
             if (getRightChild(root) != NULL)
                 root = getRightChild(root);
             else{
-                setRightChild(temp, root);
-                return;
+                setRightChild(createNode(pData), root);
+                break;
             }
         } else {
             root->count++;
+            STATS_RECORD(eStatsTreeInsert, start, depth, true);
             return;
         }
     }
+
+    retrace(pTree, depth, NULL);
+    STATS_RECORD(eStatsTreeInsert, start, depth, false);
 }
 
-int main(){
-    Tree* tree = createTree();
-    int values[] = {5,3,6,6,4};
-    for (int i = 0; i < 5; i++)
-    {
-        insert(&(values[i]), tree);
+/**
+ * Inserts keys sorted in ascending order, sharing one descent path between
+ * them. The path of the previous key is kept as a finger, and each key
+ * only climbs the finger until it reaches a subtree whose range holds the
+ * key, then descends from there. Neighbouring keys thus cost a few steps
+ * instead of a full root-to-leaf walk, and a run of equal keys costs one.
+ * The weights of the Nodes on the finger are updated when a key climbs
+ * past them, not for every key. The result is the same as calling insert
+ * for every key.
+ * 
+ * @param pKeys The keys to insert, in ascending order.
+ * @param n The number of keys.
+ * @param pTree A pointer to the Tree which the keys to be added.
+*/
+void insertSortedBatch(const TreeData* pKeys, int n, Tree* pTree){
+    /* pHigh[d] is the exclusive upper bound of the subtree at path[d], and
+       pPending[d] is the weight still to be added to path[d] and above. */
+    long long* pHigh = NULL;
+    long long* pPending = NULL;
+    int highCapacity = 0;
+    int top = 0;
+
+    for (int i = 0; i < n; ){
+        TreeData key = pKeys[i];
+        int run = 1;
+        while (i + run < n && pKeys[i + run] == key)
+            run++;
+        i += run;
+
+        if (pTree->root == NULL){
+            setRoot(createNode(&key), pTree);
+            pTree->root->count = run;
+            pTree->root->weight = run;
+            pTree->height = 1;
+            continue;
+        }
+
+        while (top > 0 && key >= pHigh[top - 1]){
+            top--;
+            pTree->path[top]->weight += pPending[top];
+            if (top > 0)
+                pPending[top - 1] += pPending[top];
+            pPending[top] = 0;
+        }
+        if (top == 0){
+            pushPath(pTree, pTree->root, 0);
+            if (highCapacity == 0){
+                highCapacity = pTree->pathCapacity;
+                pHigh = (long long*) trackedMalloc(highCapacity * sizeof(long long));
+                pPending = (long long*) trackedCalloc(highCapacity, sizeof(long long));
+                if (pHigh == NULL || pPending == NULL)
+                    OutofStorage();
+            }
+            pHigh[0] = LLONG_MAX;
+            top = 1;
+        }
+
+        int depth = top;
+        Node* pNode = pTree->path[depth - 1];
+        while (true){
+            bool left = *(pNode->data) > key;
+            if (!left && *(pNode->data) == key){
+                pNode->count += run;
+                pPending[depth - 1] += run;
+                top = depth;
+                break;
+            }
+
+            Node* pChild = left ? getLeftChild(pNode) : getRightChild(pNode);
+            long long high = left ? *(pNode->data) : pHigh[depth - 1];
+            bool created = pChild == NULL;
+            if (created){
+                pChild = createNode(&key);
+                pChild->count = run;
+                pChild->weight = run;
+                if (left)
+                    setLeftChild(pChild, pNode);
+                else
+                    setRightChild(pChild, pNode);
+                pPending[depth - 1] += run;
+
+                /* A rotation moves the Nodes below it, so the finger keeps
+                   only the ancestors above the rotated subtree. */
+                int rotated = retrace(pTree, depth, pPending);
+                if (rotated < depth){
+                    top = rotated;
+                    break;
+                }
+            }
+
+            pushPath(pTree, pChild, depth);
+            if (pTree->pathCapacity > highCapacity){
+                pHigh = (long long*) trackedRealloc(pHigh, pTree->pathCapacity * sizeof(long long));
+                pPending = (long long*) trackedRealloc(pPending,
+                                                       pTree->pathCapacity * sizeof(long long));
+                if (pHigh == NULL || pPending == NULL)
+                    OutofStorage();
+                memset(pPending + highCapacity, 0,
+                       (pTree->pathCapacity - highCapacity) * sizeof(long long));
+                highCapacity = pTree->pathCapacity;
+            }
+            pHigh[depth++] = high;
+            if (created){
+                top = depth;
+                break;
+            }
+            pNode = pChild;
+        }
     }
-    
+
+    for (int d = top - 1; d >= 0; d--){
+        pTree->path[d]->weight += pPending[d];
+        if (d > 0)
+            pPending[d - 1] += pPending[d];
+    }
+    trackedFree(pHigh);
+    trackedFree(pPending);
+}
+
+/**
+ * Checks whether the memory lies in the block allocated by
+ * buildTreeFromArray, which is freed as a whole instead of per Node.
+ * 
+ * @param pTree The Tree that owns the block.
+ * @param pMemory The memory to check.
+ * @return true if the memory is part of the block.
+*/
+bool isInBlock(Tree* pTree, void* pMemory){
+    uintptr_t address = (uintptr_t) pMemory;
+    uintptr_t start = (uintptr_t) pTree->pBlock;
+    return pTree->pBlock != NULL && address >= start && address < start + pTree->blockSize;
+}
+
+/**
+ * Deallocate a Node that was unlinked from the Tree, together with its
+ * data. Memory that belongs to the block of a bulk built Tree is left
+ * alone.
+ * 
+ * @param pTree The Tree the Node was unlinked from.
+ * @param pNode The Node to be deallocated.
+*/
+void releaseNode(Tree* pTree, Node* pNode){
+    if (!isInBlock(pTree, pNode->data))
+        trackedFree(pNode->data);
+    if (!isInBlock(pTree, pNode))
+        trackedFree(pNode);
+}
+
+/**
+ * Deallocate the Tree with every Node and its data. The Nodes are freed
+ * while the Tree is flattened by right rotations, so no stack is needed
+ * however deep the Tree is.
+ * 
+ * @param pTree A pointer to the Tree to be deallocated.
+*/
+void destroyTree(Tree* pTree){
+    Node* pNode = pTree->root;
+
+    while (pNode != NULL){
+        if (pNode->leftChild != NULL){
+            Node* pLeft = pNode->leftChild;
+            pNode->leftChild = pLeft->rightChild;
+            pLeft->rightChild = pNode;
+            pNode = pLeft;
+        } else {
+            Node* pRight = pNode->rightChild;
+            releaseNode(pTree, pNode);
+            pNode = pRight;
+        }
+    }
+
+    trackedFree(pTree->pBlock);
+    trackedFree(pTree->path);
+    trackedFree(pTree);
+}
+
+/**
+ * Removes one copy of the data from the Tree. The count of the matching
+ * Node is decreased, and the Node is removed once the count reaches zero.
+ * 
+ * @param pData A pointer to the data to be removed.
+ * @param pTree A pointer to the Tree which the data to be removed from.
+ * @return true if the data was found in the Tree.
+*/
+bool erase(TreeData* pData, Tree* pTree){
+    STATS_START(start);
+    Node* pCurr = pTree->root;
+    int depth = 0;
+
+    while (pCurr != NULL && *(pCurr->data) != *pData){
+        pushPath(pTree, pCurr, depth++);
+        if (*(pCurr->data) > *pData)
+            pCurr = getLeftChild(pCurr);
+        else
+            pCurr = getRightChild(pCurr);
+    }
+
+    if (pCurr == NULL){
+        STATS_RECORD(eStatsTreeErase, start, depth, false);
+        return false;
+    }
+
+    if (pCurr->count > 1){
+        pCurr->count--;
+        pCurr->weight--;
+        for (int i = 0; i < depth; i++)
+            pTree->path[i]->weight--;
+        STATS_RECORD(eStatsTreeErase, start, depth + 1, true);
+        return true;
+    }
+
+    if (getLeftChild(pCurr) != NULL && getRightChild(pCurr) != NULL){
+        pushPath(pTree, pCurr, depth++);
+        Node* pSucc = getRightChild(pCurr);
+        while (getLeftChild(pSucc) != NULL){
+            pushPath(pTree, pSucc, depth++);
+            pSucc = getLeftChild(pSucc);
+        }
+
+        NodeData* pTemp = pCurr->data;
+        pCurr->data = pSucc->data;
+        pCurr->count = pSucc->count;
+        pSucc->data = pTemp;
+        pCurr = pSucc;
+    }
+
+    Node* pChild = getLeftChild(pCurr) != NULL ? getLeftChild(pCurr) : getRightChild(pCurr);
+    replaceChild(pTree, depth > 0 ? pTree->path[depth - 1] : NULL, pCurr, pChild);
+    releaseNode(pTree, pCurr);
+
+    /* The successor may have moved up, so the weights on the path are
+       recomputed from below instead of decreased by one. */
+    for (int i = depth - 1; i >= 0; i--)
+        updateWeight(pTree->path[i]);
+    retrace(pTree, depth, NULL);
+    STATS_RECORD(eStatsTreeErase, start, depth + 1, true);
+    return true;
+}
+
+/**
+ * Sorts the keys with a least significant digit radix sort, one byte per
+ * pass. The sign bit is flipped so negative keys sort first.
+ * 
+ * @param pKeys The keys to sort.
+ * @param pTemp A scratch array of the same length.
+ * @param n The number of keys.
+*/
+void radixSort(TreeData* pKeys, TreeData* pTemp, int n){
+    for (int shift = 0; shift < 32; shift += 8){
+        int counts[257] = {0};
+
+        for (int i = 0; i < n; i++)
+            counts[((((unsigned int) pKeys[i]) ^ 0x80000000u) >> shift & 0xff) + 1]++;
+        for (int b = 0; b < 256; b++)
+            counts[b + 1] += counts[b];
+        for (int i = 0; i < n; i++)
+            pTemp[counts[(((unsigned int) pKeys[i]) ^ 0x80000000u) >> shift & 0xff]++] = pKeys[i];
+
+        TreeData* pSwap = pKeys;
+        pKeys = pTemp;
+        pTemp = pSwap;
+    }
+}
+
+/**
+ * Links the Nodes of a sorted range into a perfectly balanced subtree,
+ * rooted at the middle of the range.
+ * 
+ * @param pNodes The Nodes in key order.
+ * @param low The first Node of the range.
+ * @param high One past the last Node of the range.
+ * @return The root of the subtree, or NULL for an empty range.
+*/
+Node* linkBalanced(Node* pNodes, int low, int high){
+    if (low >= high)
+        return NULL;
+
+    int mid = low + (high - low) / 2;
+    Node* pRoot = &pNodes[mid];
+    setLeftChild(linkBalanced(pNodes, low, mid), pRoot);
+    setRightChild(linkBalanced(pNodes, mid + 1, high), pRoot);
+    updateHeight(pRoot);
+    updateWeight(pRoot);
+    return pRoot;
+}
+
+/**
+ * Builds a balanced Tree from an array of data in one go. The data is
+ * sorted unless it already is, equal data is collapsed into the count of
+ * one Node, and the Nodes are linked into a perfectly balanced Tree in
+ * linear time. All Nodes and their data are carved from one allocation.
+ * 
+ * The result is a balanced Tree, so later calls to insert and erase keep
+ * it balanced.
+ * 
+ * @param pData The data to be added to the Tree.
+ * @param n The number of elements in the array.
+ * @return A pointer to the new Tree.
+*/
+Tree* buildTreeFromArray(const TreeData* pData, int n){
+    Tree* pTree = createBalancedTree();
+    if (n <= 0)
+        return pTree;
+
+    TreeData* pKeys = (TreeData*) trackedMalloc(n * sizeof(TreeData));
+    int* pCounts = (int*) trackedMalloc(n * sizeof(int));
+    if (pKeys == NULL || pCounts == NULL)
+        OutofStorage();
+    memcpy(pKeys, pData, n * sizeof(TreeData));
+
+    bool sorted = true;
+    for (int i = 1; i < n && sorted; i++)
+        sorted = pKeys[i - 1] <= pKeys[i];
+    if (!sorted)
+        radixSort(pKeys, (TreeData*) pCounts, n);
+
+    int unique = 0;
+    for (int i = 0; i < n; i++){
+        if (unique > 0 && pKeys[unique - 1] == pKeys[i]){
+            pCounts[unique - 1]++;
+        } else {
+            pKeys[unique] = pKeys[i];
+            pCounts[unique] = 1;
+            unique++;
+        }
+    }
+
+    pTree->blockSize = (size_t) unique * (sizeof(Node) + sizeof(NodeData));
+    pTree->pBlock = (char*) trackedMalloc(pTree->blockSize);
+    if (pTree->pBlock == NULL)
+        OutofStorage();
+
+    Node* pNodes = (Node*) pTree->pBlock;
+    NodeData* pNodeData = (NodeData*) (pNodes + unique);
+    for (int i = 0; i < unique; i++){
+        pNodeData[i] = pKeys[i];
+        pNodes[i].data = &pNodeData[i];
+        pNodes[i].count = pCounts[i];
+    }
+
+    setRoot(linkBalanced(pNodes, 0, unique), pTree);
+    pTree->height = getNodeHeight(pTree->root);
+
+    trackedFree(pKeys);
+    trackedFree(pCounts);
+    return pTree;
+}
+
+/**
+ * Loads integers from a file descriptor into the Tree. The input is read
+ * in large chunks and parsed in place. Integers may be separated by any
+ * characters other than digits, and a '-' right before the digits makes
+ * them negative. An integer outside the range of TreeData is skipped
+ * and counted as rejected, so a wrapped key is never inserted. The keys
+ * are gathered in batches, which are radix sorted and added with
+ * insertSortedBatch.
+ * 
+ * @param pTree A pointer to the Tree which the keys to be added.
+ * @param fd The file descriptor to read until the end, such as a file or a pipe.
+ * @param pStats Set to the number of bytes read, keys loaded and integers
+ * rejected, unless it is NULL.
+ * @return false if reading failed or an integer was rejected. The other
+ * keys read before the failure are loaded.
+*/
+bool loadTreeFromFd(Tree* pTree, int fd, TreeLoadStats* pStats){
+    char* pBuffer = (char*) trackedMalloc(LOAD_BUFFER_SIZE);
+    TreeData* pBatch = (TreeData*) trackedMalloc(LOAD_BATCH_SIZE * sizeof(TreeData));
+    TreeData* pTemp = (TreeData*) trackedMalloc(LOAD_BATCH_SIZE * sizeof(TreeData));
+    if (pBuffer == NULL || pBatch == NULL || pTemp == NULL)
+        OutofStorage();
+
+    TreeLoadStats stats = {0, 0, 0};
+    int count = 0;
+    unsigned int value = 0;
+    unsigned int limit = INT_MAX;
+    bool inNumber = false;
+    bool negative = false;
+    bool overflow = false;
+    bool minus = false;
+    bool ok = true;
+
+    while (true){
+        ssize_t length = read(fd, pBuffer, LOAD_BUFFER_SIZE);
+        if (length < 0 && errno == EINTR)
+            continue;
+        if (length < 0)
+            ok = false;
+        if (length <= 0)
+            break;
+        stats.bytes += length;
+
+        for (ssize_t i = 0; i < length; i++){
+            unsigned int digit = (unsigned char) pBuffer[i] - '0';
+            if (digit < 10){
+                if (!inNumber){
+                    inNumber = true;
+                    negative = minus;
+                    overflow = false;
+                    value = 0;
+                    limit = negative ? (unsigned int) INT_MAX + 1u : (unsigned int) INT_MAX;
+                }
+                if (value > (limit - digit) / 10)
+                    overflow = true;
+                else
+                    value = value * 10 + digit;
+                continue;
+            }
+            minus = pBuffer[i] == '-';
+            if (!inNumber)
+                continue;
+
+            inNumber = false;
+            if (overflow){
+                stats.rejected++;
+                continue;
+            }
+            pBatch[count++] = (TreeData) (negative ? 0u - value : value);
+            if (count == LOAD_BATCH_SIZE){
+                radixSort(pBatch, pTemp, count);
+                insertSortedBatch(pBatch, count, pTree);
+                stats.keys += count;
+                count = 0;
+            }
+        }
+    }
+
+    if (inNumber && overflow)
+        stats.rejected++;
+    else if (inNumber)
+        pBatch[count++] = (TreeData) (negative ? 0u - value : value);
+    radixSort(pBatch, pTemp, count);
+    insertSortedBatch(pBatch, count, pTree);
+    stats.keys += count;
+
+    trackedFree(pBuffer);
+    trackedFree(pBatch);
+    trackedFree(pTemp);
+    if (pStats != NULL)
+        *pStats = stats;
+    return ok && stats.rejected == 0;
+}
+
+/**
+ * Finds the Node that holds the given data.
+ * 
+ * @param pData A pointer to the data to look for.
+ * @param pTree A pointer to the Tree to search.
+ * @return A pointer to the Node, or NULL if the data is not in the Tree.
+*/
+Node* find(TreeData* pData, Tree* pTree){
+    STATS_START(start);
+    Node* pCurr = pTree->root;
+    int depth = 0;
+
+    while (pCurr != NULL && *(pCurr->data) != *pData){
+        STATS_STEP(depth, 1);
+        if (*(pCurr->data) > *pData)
+            pCurr = getLeftChild(pCurr);
+        else
+            pCurr = getRightChild(pCurr);
+    }
+    STATS_RECORD(eStatsTreeFind, start, depth + (pCurr != NULL), pCurr != NULL);
+    return pCurr;
+}
+
+/**
+ * Finds the Node with the smallest data that is not less than the given
+ * data.
+ * 
+ * @param pData A pointer to the data to compare against.
+ * @param pTree A pointer to the Tree to search.
+ * @return A pointer to the Node, or NULL if there is no such Node.
+*/
+Node* lowerBound(TreeData* pData, Tree* pTree){
+    Node* pCurr = pTree->root;
+    Node* pBound = NULL;
+
+    while (pCurr != NULL){
+        if (*(pCurr->data) >= *pData){
+            pBound = pCurr;
+            pCurr = getLeftChild(pCurr);
+        } else {
+            pCurr = getRightChild(pCurr);
+        }
+    }
+    return pBound;
+}
+
+/**
+ * Finds the Node with the smallest data that is greater than the given
+ * data.
+ * 
+ * @param pData A pointer to the data to compare against.
+ * @param pTree A pointer to the Tree to search.
+ * @return A pointer to the Node, or NULL if there is no such Node.
+*/
+Node* upperBound(TreeData* pData, Tree* pTree){
+    Node* pCurr = pTree->root;
+    Node* pBound = NULL;
+
+    while (pCurr != NULL){
+        if (*(pCurr->data) > *pData){
+            pBound = pCurr;
+            pCurr = getLeftChild(pCurr);
+        } else {
+            pCurr = getRightChild(pCurr);
+        }
+    }
+    return pBound;
+}
+
+/**
+ * Gets the number of copies of data in the Tree, counting every
+ * duplicate.
+ * 
+ * @param pTree A pointer to the Tree.
+ * @return The sum of the counts of all Nodes.
+*/
+long long getTotalCount(Tree* pTree){
+    return getNodeWeight(pTree->root);
+}
+
+/**
+ * Counts the copies of data in the Tree that are less than the given
+ * data. Whole left subtrees are counted by their weight, so this walks a
+ * single path from the root.
+ * 
+ * @param pData A pointer to the data to compare against.
+ * @param pTree A pointer to the Tree to search.
+ * @return The rank of the data, from 0 to getTotalCount.
+*/
+long long getRank(TreeData* pData, Tree* pTree){
+    Node* pCurr = pTree->root;
+    long long rank = 0;
+
+    while (pCurr != NULL){
+        if (*(pCurr->data) >= *pData){
+            if (*(pCurr->data) == *pData)
+                return rank + getNodeWeight(getLeftChild(pCurr));
+            pCurr = getLeftChild(pCurr);
+        } else {
+            rank += getNodeWeight(getLeftChild(pCurr)) + pCurr->count;
+            pCurr = getRightChild(pCurr);
+        }
+    }
+    return rank;
+}
+
+/**
+ * Finds the Node that holds the k-th smallest copy of data, counting
+ * every duplicate, so the copies k = getRank(x) up to getRank(x) +
+ * count - 1 all belong to the Node of x.
+ * 
+ * @param k The position of the copy, starting from 0.
+ * @param pTree A pointer to the Tree to search.
+ * @return A pointer to the Node, or NULL if k is not less than getTotalCount.
+*/
+Node* selectNode(long long k, Tree* pTree){
+    Node* pCurr = pTree->root;
+
+    if (k < 0)
+        return NULL;
+    while (pCurr != NULL){
+        long long left = getNodeWeight(getLeftChild(pCurr));
+        if (k < left){
+            pCurr = getLeftChild(pCurr);
+        } else if (k < left + pCurr->count){
+            return pCurr;
+        } else {
+            k -= left + pCurr->count;
+            pCurr = getRightChild(pCurr);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Finds the Node at the given percentile of all copies of data, using the
+ * nearest rank: the smallest data that at least p percent of the copies
+ * are less than or equal to.
+ * 
+ * @param p The percentile, from 0 to 100. 99 gives the p99 of the data.
+ * @param pTree A pointer to the Tree to search.
+ * @return A pointer to the Node, or NULL if the Tree is empty.
+*/
+Node* percentile(double p, Tree* pTree){
+    long long total = getTotalCount(pTree);
+    double position = p / 100.0 * total;
+    long long k = (long long) position;
+
+    /* The nearest rank is position rounded up, and k counts from 0. */
+    if (k < position)
+        k++;
+    k--;
+    if (k < 0)
+        k = 0;
+    if (k >= total)
+        k = total - 1;
+    return selectNode(k, pTree);
+}
+
+/**
+ * Pushes a Node on the stack of the iterator, growing the stack when
+ * needed.
+ * 
+ * @param pIter The iterator.
+ * @param pNode The Node to be pushed.
+*/
+void pushIterator(TreeIterator* pIter, Node* pNode){
+    if (pIter->top == pIter->capacity){
+        int capacity = pIter->capacity == 0 ? 64 : pIter->capacity * 2;
+        Node** stack = (Node**) trackedRealloc(pIter->stack, capacity * sizeof(Node*));
+        if (stack == NULL)
+            OutofStorage();
+        pIter->stack = stack;
+        pIter->capacity = capacity;
+    }
+    pIter->stack[pIter->top++] = pNode;
+}
+
+/**
+ * Pushes the Node and the whole chain of its left children.
+ * 
+ * @param pIter The iterator.
+ * @param pNode The first Node of the chain, or NULL.
+*/
+void pushLeftChain(TreeIterator* pIter, Node* pNode){
+    while (pNode != NULL){
+        pushIterator(pIter, pNode);
+        pNode = getLeftChild(pNode);
+    }
+}
+
+/**
+ * Creates an iterator that visits the Nodes of the Tree in order. The
+ * iterator keeps its own stack instead of recursing, so it works on Trees
+ * of any depth. The Tree must not be changed while it is iterated.
+ * 
+ * @param pTree A pointer to the Tree to iterate.
+ * @return A pointer to the new iterator, positioned at the smallest data.
+*/
+TreeIterator* createTreeIterator(Tree* pTree){
+    TreeIterator* pIter = (TreeIterator*) trackedCalloc(1, sizeof(TreeIterator));
+    if (pIter == NULL)
+        OutofStorage();
+    pushLeftChain(pIter, pTree->root);
+    return pIter;
+}
+
+/**
+ * Moves the iterator to the smallest data that is not less than the given
+ * data. Only the Nodes on the search path are pushed.
+ * 
+ * @param pIter The iterator.
+ * @param pTree A pointer to the Tree being iterated.
+ * @param pData A pointer to the data to seek to.
+*/
+void seekTreeIterator(TreeIterator* pIter, Tree* pTree, TreeData* pData){
+    Node* pCurr = pTree->root;
+
+    pIter->top = 0;
+    while (pCurr != NULL){
+        if (*(pCurr->data) >= *pData){
+            pushIterator(pIter, pCurr);
+            pCurr = getLeftChild(pCurr);
+        } else {
+            pCurr = getRightChild(pCurr);
+        }
+    }
+}
+
+/**
+ * Checks whether the iterator has more Nodes to visit.
+ * 
+ * @param pIter The iterator.
+ * @return true if nextNode will return a Node.
+*/
+bool hasNext(TreeIterator* pIter){
+    return pIter->top > 0;
+}
+
+/**
+ * Gets the next Node in order and advances the iterator.
+ * 
+ * @param pIter The iterator.
+ * @return A pointer to the next Node, or NULL when the iteration is over.
+*/
+Node* nextNode(TreeIterator* pIter){
+    if (!hasNext(pIter))
+        return NULL;
+    Node* pNode = pIter->stack[--pIter->top];
+    pushLeftChain(pIter, getRightChild(pNode));
+    return pNode;
+}
+
+/**
+ * Deallocate the iterator. The Tree is not changed.
+ * 
+ * @param pIter The iterator to be deallocated.
+*/
+void deleteTreeIterator(TreeIterator* pIter){
+    trackedFree(pIter->stack);
+    trackedFree(pIter);
+}
+
+/**
+ * Visits in order every Node whose data lies between the given bounds,
+ * both inclusive. Subtrees that are entirely outside the range are never
+ * entered.
+ * 
+ * @param pTree A pointer to the Tree to search.
+ * @param pLow A pointer to the lower bound.
+ * @param pHigh A pointer to the upper bound.
+ * @param visit The function called with each Node in the range.
+ * @param pContext A pointer passed through to the visit function.
+*/
+void rangeQuery(Tree* pTree, TreeData* pLow, TreeData* pHigh,
+                void (*visit)(Node* pNode, void* pContext), void* pContext){
+    TreeIterator iter = {NULL, 0, 0};
+
+    seekTreeIterator(&iter, pTree, pLow);
+    while (hasNext(&iter)){
+        Node* pNode = nextNode(&iter);
+        if (*(pNode->data) > *pHigh)
+            break;
+        visit(pNode, pContext);
+    }
+    trackedFree(iter.stack);
+}
+
+/**
+ * Writes the Tree to a file that openMappedTree can map. The Nodes are
+ * written in level order, so the top levels of the Tree, which every
+ * lookup passes, share the first pages of the file.
+ * 
+ * @param pTree A pointer to the Tree to be saved.
+ * @param pPath The path of the file to write.
+ * @return false if the file could not be written.
+*/
+bool saveTree(Tree* pTree, const char* pPath){
+    FILE* pFile = fopen(pPath, "wb");
+    if (pFile == NULL)
+        return false;
+
+    MappedTreeHeader header = {{'T', 'R', 'E', 'E'}, MAPPED_TREE_VERSION,
+                               sizeof(MappedTreeNode), 0,
+                               pTree->root != NULL ? 0 : -1, getHeight(pTree)};
+    bool written = fwrite(&header, sizeof(header), 1, pFile) == 1;
+
+    int capacity = 1024;
+    int head = 0;
+    int tail = 0;
+    Node** pQueue = (Node**) trackedMalloc(capacity * sizeof(Node*));
+    if (pQueue == NULL)
+        OutofStorage();
+    if (pTree->root != NULL)
+        pQueue[tail++] = pTree->root;
+
+    while (written && head < tail){
+        Node* pNode = pQueue[head++];
+        Node* children[2] = {getLeftChild(pNode), getRightChild(pNode)};
+        MappedTreeNode record = {*(pNode->data), pNode->count, -1, -1};
+
+        for (int c = 0; c < 2; c++){
+            if (children[c] == NULL)
+                continue;
+            if (tail == capacity){
+                capacity *= 2;
+                pQueue = (Node**) trackedRealloc(pQueue, capacity * sizeof(Node*));
+                if (pQueue == NULL)
+                    OutofStorage();
+            }
+            if (c == 0)
+                record.left = tail;
+            else
+                record.right = tail;
+            pQueue[tail++] = children[c];
+        }
+        written = fwrite(&record, sizeof(record), 1, pFile) == 1;
+    }
+    trackedFree(pQueue);
+
+    header.nodeCount = tail;
+    written = written && fseek(pFile, 0, SEEK_SET) == 0
+              && fwrite(&header, sizeof(header), 1, pFile) == 1;
+    return fclose(pFile) == 0 && written;
+}
+
+/**
+ * Maps a file written by saveTree read-only. The Tree can be queried as
+ * soon as this returns: nothing is parsed or allocated, and the pages of
+ * the file are only read when a lookup first touches them.
+ * 
+ * @param pMapped Set to the mapped Tree.
+ * @param pPath The path of the file.
+ * @return false if the file could not be mapped or is not a saved Tree.
+*/
+bool openMappedTree(MappedTree* pMapped, const char* pPath){
+    int fd = open(pPath, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t) info.st_size < sizeof(MappedTreeHeader)){
+        close(fd);
+        return false;
+    }
+
+    void* pBase = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (pBase == MAP_FAILED)
+        return false;
+
+    const MappedTreeHeader* pHeader = (const MappedTreeHeader*) pBase;
+    if (memcmp(pHeader->magic, "TREE", 4) != 0 || pHeader->version != MAPPED_TREE_VERSION
+        || pHeader->nodeSize != sizeof(MappedTreeNode)
+        || (size_t) info.st_size != sizeof(MappedTreeHeader)
+                                    + (size_t) pHeader->nodeCount * sizeof(MappedTreeNode)){
+        munmap(pBase, info.st_size);
+        return false;
+    }
+
+    pMapped->pBase = pBase;
+    pMapped->size = info.st_size;
+    pMapped->pHeader = pHeader;
+    pMapped->pNodes = (const MappedTreeNode*) (pHeader + 1);
+    return true;
+}
+
+/**
+ * Gets the number of Nodes in a mapped Tree.
+ * 
+ * @param pMapped A pointer to the mapped Tree.
+ * @return The number of Nodes.
+*/
+int getMappedTreeSize(MappedTree* pMapped){
+    return (int) pMapped->pHeader->nodeCount;
+}
+
+/**
+ * Finds the Node that holds the given data in a mapped Tree. A child
+ * index outside the Node array ends the search, so a damaged file can
+ * not make the lookup read outside the mapping. saveTree writes the Nodes
+ * in level order, so every child comes after its parent. A child index
+ * that does not grow also ends the search, so a damaged file can not make
+ * the lookup loop, and it takes at most one step per Node.
+ * 
+ * @param pData A pointer to the data to look for.
+ * @param pMapped A pointer to the mapped Tree to search.
+ * @return A pointer to the Node, or NULL if the data is not in the Tree
+ * or the file is damaged.
+*/
+const MappedTreeNode* findMappedTree(TreeData* pData, MappedTree* pMapped){
+    uint32_t count = pMapped->pHeader->nodeCount;
+    int32_t index = pMapped->pHeader->root;
+
+    while ((uint32_t) index < count){
+        const MappedTreeNode* pNode = &pMapped->pNodes[index];
+        int32_t child;
+        if (pNode->data > *pData)
+            child = pNode->left;
+        else if (pNode->data < *pData)
+            child = pNode->right;
+        else
+            return pNode;
+
+        if (child <= index)
+            return NULL;
+        index = child;
+    }
+    return NULL;
+}
+
+/**
+ * Unmaps a Tree mapped by openMappedTree.
+ * 
+ * @param pMapped A pointer to the mapped Tree.
+*/
+void closeMappedTree(MappedTree* pMapped){
+    munmap(pMapped->pBase, pMapped->size);
+    pMapped->pBase = NULL;
+    pMapped->pHeader = NULL;
+    pMapped->pNodes = NULL;
+}
+
+/**
+ * Creates an empty ArenaTree. The Node array grows by half its size when
+ * it is full, so a Tree whose final size is known should be created with
+ * that capacity to avoid the copies and the unused slots.
+ * 
+ * @param capacity The number of keys to reserve room for.
+ * @return A pointer to the new ArenaTree.
+*/
+ArenaTree* createArenaTree(int capacity){
+    ArenaTree* pTree = (ArenaTree*) trackedCalloc(1, sizeof(ArenaTree));
+    if (pTree == NULL)
+        OutofStorage();
+    pTree->used = 1;
+    pTree->capacity = capacity > 0 ? (uint32_t) capacity + 1 : 16;
+
+    char* pBlock = (char*) trackedCalloc(pTree->capacity, sizeof(ArenaNode) + sizeof(uint8_t));
+    if (pBlock == NULL)
+        OutofStorage();
+    pTree->pNodes = (ArenaNode*) pBlock;
+    pTree->pHeights = (uint8_t*) (pBlock + (size_t) pTree->capacity * sizeof(ArenaNode));
+    return pTree;
+}
+
+/**
+ * Grows the Node array of the ArenaTree by half. The heights are moved
+ * to the end of the larger block.
+ * 
+ * @param pTree A pointer to the ArenaTree.
+*/
+static void growArena(ArenaTree* pTree){
+    if (pTree->capacity == UINT32_MAX)
+        OutofStorage();
+    /* The + 1 makes sure that small capacities grow as well. */
+    uint32_t capacity = pTree->capacity > (UINT32_MAX - 1) / 3 * 2
+                        ? UINT32_MAX : pTree->capacity + pTree->capacity / 2 + 1;
+    char* pBlock = (char*) trackedRealloc(pTree->pNodes,
+                                          (size_t) capacity * (sizeof(ArenaNode) + sizeof(uint8_t)));
+    if (pBlock == NULL)
+        OutofStorage();
+
+    uint8_t* pHeights = (uint8_t*) (pBlock + (size_t) capacity * sizeof(ArenaNode));
+    memmove(pHeights, pBlock + (size_t) pTree->capacity * sizeof(ArenaNode), pTree->capacity);
+    pTree->pNodes = (ArenaNode*) pBlock;
+    pTree->pHeights = pHeights;
+    pTree->capacity = capacity;
+}
+
+/**
+ * Takes a slot for a new leaf, reusing a removed Node if there is one.
+ * The Node array may move, so indices stay valid but pointers do not.
+ * 
+ * @param pTree A pointer to the ArenaTree.
+ * @param data The key of the new Node.
+ * @return The index of the new Node.
+*/
+static uint32_t createArenaNode(ArenaTree* pTree, TreeData data){
+    uint32_t index = pTree->freeList;
+    if (index != ARENA_NONE){
+        pTree->freeList = pTree->pNodes[index].left;
+    } else {
+        if (pTree->used == pTree->capacity)
+            growArena(pTree);
+        index = pTree->used++;
+    }
+
+    ArenaNode* pNode = &pTree->pNodes[index];
+    pNode->data = data;
+    pNode->count = 1;
+    pNode->left = ARENA_NONE;
+    pNode->right = ARENA_NONE;
+    pTree->pHeights[index] = 1;
+    pTree->size++;
+    return index;
+}
+
+/**
+ * Recomputes the height of a Node of the ArenaTree from its children.
+ * 
+ * @param pTree A pointer to the ArenaTree.
+ * @param index The index of the Node.
+*/
+static void updateArenaHeight(ArenaTree* pTree, uint32_t index){
+    uint8_t left = pTree->pHeights[pTree->pNodes[index].left];
+    uint8_t right = pTree->pHeights[pTree->pNodes[index].right];
+    pTree->pHeights[index] = (left > right ? left : right) + 1;
+}
+
+static uint32_t rotateArenaLeft(ArenaTree* pTree, uint32_t index){
+    uint32_t right = pTree->pNodes[index].right;
+    pTree->pNodes[index].right = pTree->pNodes[right].left;
+    pTree->pNodes[right].left = index;
+    updateArenaHeight(pTree, index);
+    updateArenaHeight(pTree, right);
+    return right;
+}
+
+static uint32_t rotateArenaRight(ArenaTree* pTree, uint32_t index){
+    uint32_t left = pTree->pNodes[index].left;
+    pTree->pNodes[index].left = pTree->pNodes[left].right;
+    pTree->pNodes[left].right = index;
+    updateArenaHeight(pTree, index);
+    updateArenaHeight(pTree, left);
+    return left;
+}
+
+/**
+ * Restores the AVL property of a subtree of the ArenaTree, like rebalance.
+ * 
+ * @param pTree A pointer to the ArenaTree.
+ * @param index The index of the root Node of the subtree.
+ * @return The index of the new root Node of the subtree.
+*/
+static uint32_t rebalanceArena(ArenaTree* pTree, uint32_t index){
+    ArenaNode* pNodes = pTree->pNodes;
+    uint8_t* pHeights = pTree->pHeights;
+    uint32_t left = pNodes[index].left;
+    uint32_t right = pNodes[index].right;
+    int balance = pHeights[left] - pHeights[right];
+
+    if (balance > 1){
+        if (pHeights[pNodes[left].left] < pHeights[pNodes[left].right])
+            pNodes[index].left = rotateArenaLeft(pTree, left);
+        return rotateArenaRight(pTree, index);
+    }
+    if (balance < -1){
+        if (pHeights[pNodes[right].right] < pHeights[pNodes[right].left])
+            pNodes[index].right = rotateArenaRight(pTree, right);
+        return rotateArenaLeft(pTree, index);
+    }
+    return index;
+}
+
+/**
+ * Replaces a child of the parent Node, or the root of the ArenaTree when
+ * there is no parent.
+ * 
+ * @param pTree A pointer to the ArenaTree.
+ * @param parent The index of the parent Node, or ARENA_NONE for the root.
+ * @param old The index of the child to be replaced.
+ * @param index The index of the Node to take its place.
+*/
+static void replaceArenaChild(ArenaTree* pTree, uint32_t parent, uint32_t old, uint32_t index){
+    if (parent == ARENA_NONE)
+        pTree->root = index;
+    else if (pTree->pNodes[parent].left == old)
+        pTree->pNodes[parent].left = index;
+    else
+        pTree->pNodes[parent].right = index;
+}
+
+/**
+ * Walks the search path back towards the root like retrace, updating the
+ * heights and rotating unbalanced subtrees.
+ * 
+ * @param pTree A pointer to the ArenaTree.
+ * @param pPath The indices of the Nodes on the path, from the root.
+ * @param depth The number of Nodes on the path.
+*/
+static void retraceArena(ArenaTree* pTree, const uint32_t* pPath, int depth){
+    for (int i = depth - 1; i >= 0; i--){
+        uint32_t index = pPath[i];
+        uint8_t oldHeight = pTree->pHeights[index];
+
+        updateArenaHeight(pTree, index);
+        uint32_t subRoot = rebalanceArena(pTree, index);
+
+        if (subRoot != index)
+            replaceArenaChild(pTree, i > 0 ? pPath[i - 1] : ARENA_NONE, index, subRoot);
+        else if (pTree->pHeights[index] == oldHeight)
+            break;
+    }
+}
+
+/**
+ * Insert data to the ArenaTree. Like insert on a balanced Tree, a key
+ * that is already there only has its count increased.
+ * 
+ * @param pData A pointer to the data to be added to the ArenaTree.
+ * @param pTree A pointer to the ArenaTree which the data to be added.
+*/
+void insertArena(TreeData* pData, ArenaTree* pTree){
+    uint32_t path[ARENA_MAX_HEIGHT];
+    int depth = 0;
+    uint32_t index = pTree->root;
+
+    if (index == ARENA_NONE){
+        pTree->root = createArenaNode(pTree, *pData);
+        return;
+    }
+
+    while (true){
+        ArenaNode* pNode = &pTree->pNodes[index];
+        path[depth++] = index;
+        if (pNode->data == *pData){
+            pNode->count++;
+            return;
+        }
+
+        uint32_t next = pNode->data > *pData ? pNode->left : pNode->right;
+        if (next == ARENA_NONE){
+            /* The array may move, so the parent is found again by index. */
+            uint32_t child = createArenaNode(pTree, *pData);
+            if (pTree->pNodes[index].data > *pData)
+                pTree->pNodes[index].left = child;
+            else
+                pTree->pNodes[index].right = child;
+            break;
+        }
+        index = next;
+    }
+
+    retraceArena(pTree, path, depth);
+}
+
+/**
+ * Removes one copy of the data from the ArenaTree. The slot of a removed
+ * Node is kept for the next insertion.
+ * 
+ * @param pData A pointer to the data to be removed.
+ * @param pTree A pointer to the ArenaTree which the data to be removed from.
+ * @return true if the data was found in the ArenaTree.
+*/
+bool eraseArena(TreeData* pData, ArenaTree* pTree){
+    ArenaNode* pNodes = pTree->pNodes;
+    uint32_t path[ARENA_MAX_HEIGHT];
+    int depth = 0;
+    uint32_t index = pTree->root;
+
+    while (index != ARENA_NONE && pNodes[index].data != *pData){
+        path[depth++] = index;
+        index = pNodes[index].data > *pData ? pNodes[index].left : pNodes[index].right;
+    }
+
+    if (index == ARENA_NONE)
+        return false;
+
+    if (pNodes[index].count > 1){
+        pNodes[index].count--;
+        return true;
+    }
+
+    if (pNodes[index].left != ARENA_NONE && pNodes[index].right != ARENA_NONE){
+        path[depth++] = index;
+        uint32_t succ = pNodes[index].right;
+        while (pNodes[succ].left != ARENA_NONE){
+            path[depth++] = succ;
+            succ = pNodes[succ].left;
+        }
+        pNodes[index].data = pNodes[succ].data;
+        pNodes[index].count = pNodes[succ].count;
+        index = succ;
+    }
+
+    uint32_t child = pNodes[index].left != ARENA_NONE ? pNodes[index].left : pNodes[index].right;
+    replaceArenaChild(pTree, depth > 0 ? path[depth - 1] : ARENA_NONE, index, child);
+    pNodes[index].left = pTree->freeList;
+    pTree->freeList = index;
+    pTree->size--;
+
+    retraceArena(pTree, path, depth);
+    return true;
+}
+
+/**
+ * Finds the Node that holds the given data in the ArenaTree.
+ * 
+ * @param pData A pointer to the data to look for.
+ * @param pTree A pointer to the ArenaTree to search.
+ * @return A pointer to the Node, or NULL if the data is not in the Tree.
+ * The pointer is valid until the next insertion.
+*/
+ArenaNode* findArena(TreeData* pData, ArenaTree* pTree){
+    ArenaNode* pNodes = pTree->pNodes;
+    uint32_t index = pTree->root;
+
+    while (index != ARENA_NONE){
+        if (pNodes[index].data > *pData)
+            index = pNodes[index].left;
+        else if (pNodes[index].data < *pData)
+            index = pNodes[index].right;
+        else
+            return &pNodes[index];
+    }
+    return NULL;
+}
+
+/**
+ * Calls the visit function on every Node of the ArenaTree in order.
+ * 
+ * @param pTree A pointer to the ArenaTree.
+ * @param visit The function called with each Node and the context.
+ * @param pContext A pointer passed to every call of visit.
+*/
+void visitArena(ArenaTree* pTree, void (*visit)(ArenaNode* pNode, void* pContext), void* pContext){
+    uint32_t stack[ARENA_MAX_HEIGHT];
+    int top = 0;
+    uint32_t index = pTree->root;
+
+    while (index != ARENA_NONE || top > 0){
+        while (index != ARENA_NONE){
+            stack[top++] = index;
+            index = pTree->pNodes[index].left;
+        }
+        index = stack[--top];
+        visit(&pTree->pNodes[index], pContext);
+        index = pTree->pNodes[index].right;
+    }
+}
+
+/**
+ * Gets the number of distinct keys in the ArenaTree.
+ * 
+ * @param pTree A pointer to the ArenaTree.
+ * @return The number of Nodes.
+*/
+int getArenaSize(ArenaTree* pTree){
+    return pTree->size;
+}
+
+/**
+ * Gets the height of the ArenaTree.
+ * 
+ * @param pTree A pointer to the ArenaTree.
+ * @return The height, 0 for an empty Tree.
+*/
+int getArenaHeight(ArenaTree* pTree){
+    return pTree->pHeights[pTree->root];
+}
+
+/**
+ * Gets the number of bytes the ArenaTree has allocated, including the
+ * slots that are not used yet.
+ * 
+ * @param pTree A pointer to the ArenaTree.
+ * @return The size of the Node array and the Tree in bytes.
+*/
+size_t getArenaMemory(ArenaTree* pTree){
+    return sizeof(ArenaTree) + (size_t) pTree->capacity * (sizeof(ArenaNode) + sizeof(uint8_t));
+}
+
+/**
+ * Deallocate the ArenaTree. All of its Nodes go with a single free of the
+ * Node array.
+ * 
+ * @param pTree A pointer to the ArenaTree to be deallocated.
+*/
+void destroyArenaTree(ArenaTree* pTree){
+    trackedFree(pTree->pNodes);
+    trackedFree(pTree);
+}
+
+/**
+ * Creates an empty ConcurrentTree.
+ * 
+ * @return A pointer to the new ConcurrentTree.
+*/
+ConcurrentTree* createConcurrentTree(){
+    ConcurrentTree* pTree = (ConcurrentTree*) trackedMalloc(sizeof(ConcurrentTree));
+    if (pTree == NULL)
+        OutofStorage();
+    atomic_init(&pTree->root, NULL);
+    atomic_init(&pTree->pending, NULL);
+    atomic_init(&pTree->rebalancing, false);
+    pTree->pPath = NULL;
+    pTree->pathCapacity = 0;
+    return pTree;
+}
+
+/**
+ * Creates a new ConcurrentNode holding one copy of the data. The Node is
+ * private to the calling thread until it is linked into the Tree.
+ * 
+ * @param data The key of the new Node.
+ * @return A pointer to the new ConcurrentNode.
+*/
+ConcurrentNode* createConcurrentNode(TreeData data){
+    ConcurrentNode* pNode = (ConcurrentNode*) trackedMalloc(sizeof(ConcurrentNode));
+    if (pNode == NULL)
+        OutofStorage();
+    pNode->data = data;
+    atomic_init(&pNode->count, 1);
+    atomic_init(&pNode->leftChild, NULL);
+    atomic_init(&pNode->rightChild, NULL);
+    atomic_init(&pNode->version, 0);
+    pNode->height = 1;
+    pNode->pNextPending = NULL;
+    return pNode;
+}
+
+/**
+ * Gets the child link of the Node that the search for the data follows.
+ * 
+ * @param pNode The Node whose key differs from the data.
+ * @param data The data being searched for.
+ * @return A pointer to the left or the right child link.
+*/
+static inline _Atomic(ConcurrentNode*)* getConcurrentLink(ConcurrentNode* pNode, TreeData data){
+    return pNode->data > data ? &pNode->leftChild : &pNode->rightChild;
+}
+
+/**
+ * Locks a ConcurrentNode by setting the lowest bit of its version. The
+ * lock is held only while a link of the Node changes.
+ * 
+ * @param pNode The Node to lock.
+*/
+static void lockConcurrentNode(ConcurrentNode* pNode){
+    unsigned int version = atomic_load_explicit(&pNode->version, memory_order_relaxed);
+
+    while (true){
+        if ((version & CONCURRENT_LOCKED) == 0
+            && atomic_compare_exchange_weak_explicit(&pNode->version, &version,
+                                                     version | CONCURRENT_LOCKED,
+                                                     memory_order_acquire, memory_order_relaxed))
+            return;
+        if (version & CONCURRENT_LOCKED){
+            sched_yield();
+            version = atomic_load_explicit(&pNode->version, memory_order_relaxed);
+        }
+    }
+}
+
+static inline void unlockConcurrentNode(ConcurrentNode* pNode){
+    atomic_fetch_and_explicit(&pNode->version, ~CONCURRENT_LOCKED, memory_order_release);
+}
+
+/**
+ * Reads the version of a ConcurrentNode, waiting while a rotation moves
+ * the Node down.
+ * 
+ * @param pNode The Node.
+ * @return The version, which is not shrinking.
+*/
+static unsigned int getStableVersion(ConcurrentNode* pNode){
+    unsigned int version;
+
+    while ((version = atomic_load_explicit(&pNode->version, memory_order_acquire))
+           & CONCURRENT_SHRINKING)
+        sched_yield();
+    return version;
+}
+
+/**
+ * Checks that no rotation moved a ConcurrentNode down since its version
+ * was read. The lock bit is ignored. A rotation marks the Node before it
+ * releases a link, so a search that acquired one of those links also sees
+ * the mark here.
+ * 
+ * @param pNode The Node.
+ * @param version The version read before.
+ * @return true if the Node was not moved down.
+*/
+static inline bool hasConcurrentVersion(ConcurrentNode* pNode, unsigned int version){
+    unsigned int now = atomic_load_explicit(&pNode->version, memory_order_acquire);
+    return ((now ^ version) & ~CONCURRENT_LOCKED) == 0;
+}
+
+/**
+ * Searches the ConcurrentTree for the data without taking a lock. Before
+ * the search steps to a child, it checks that the Node it stands on was
+ * not moved down since it read the version of the Node, and that the
+ * child is still linked there, so the data always belongs below the Node
+ * it stands on. Otherwise it starts over from the root.
+ * 
+ * @param data The data to look for.
+ * @param pTree A pointer to the ConcurrentTree to search.
+ * @param ppParent When the data is not found, set to the Node whose empty
+ * link the data belongs at, or NULL if the Tree is empty.
+ * @param pVersion Set to the version of that Node.
+ * @return A pointer to the Node holding the data, or NULL.
+*/
+static ConcurrentNode* searchConcurrent(TreeData data, ConcurrentTree* pTree,
+                                        ConcurrentNode** ppParent, unsigned int* pVersion){
+    while (true){
+        ConcurrentNode* pNode = atomic_load_explicit(&pTree->root, memory_order_acquire);
+        if (pNode == NULL){
+            *ppParent = NULL;
+            return NULL;
+        }
+        unsigned int version = getStableVersion(pNode);
+        if (atomic_load_explicit(&pTree->root, memory_order_acquire) != pNode)
+            continue;
+
+        while (pNode->data != data){
+            _Atomic(ConcurrentNode*)* pLink = getConcurrentLink(pNode, data);
+            ConcurrentNode* pChild = atomic_load_explicit(pLink, memory_order_acquire);
+            if (!hasConcurrentVersion(pNode, version))
+                break;
+            if (pChild == NULL){
+                *ppParent = pNode;
+                *pVersion = version;
+                return NULL;
+            }
+
+            unsigned int childVersion = getStableVersion(pChild);
+            if (atomic_load_explicit(pLink, memory_order_acquire) != pChild
+                || !hasConcurrentVersion(pNode, version))
+                break;
+            pNode = pChild;
+            version = childVersion;
+        }
+        if (pNode->data == data)
+            return pNode;
+    }
+}
+
+/**
+ * Finds the Node that holds the given data in the ConcurrentTree.
+ * 
+ * @param data The data to look for.
+ * @param pTree A pointer to the ConcurrentTree to search.
+ * @return A pointer to the Node, or NULL if no Node was ever linked for
+ * the data.
+*/
+static ConcurrentNode* findConcurrentNode(TreeData data, ConcurrentTree* pTree){
+    ConcurrentNode* pParent;
+    unsigned int version;
+    return searchConcurrent(data, pTree, &pParent, &version);
+}
+
+static inline int getConcurrentHeight(ConcurrentNode* pNode){
+    return pNode == NULL ? 0 : pNode->height;
+}
+
+/**
+ * Updates the height of a ConcurrentNode from its children. Only the
+ * thread that rebalances may call it. The loads acquire, so the height of
+ * a leaf that was just linked is seen.
+ * 
+ * @param pNode The Node to update.
+*/
+static void updateConcurrentHeight(ConcurrentNode* pNode){
+    int left = getConcurrentHeight(atomic_load_explicit(&pNode->leftChild, memory_order_acquire));
+    int right = getConcurrentHeight(atomic_load_explicit(&pNode->rightChild, memory_order_acquire));
+    pNode->height = (left > right ? left : right) + 1;
+}
+
+/**
+ * Rotates the subtree below a link of the ConcurrentTree. The Nodes whose
+ * links change are locked from the top down, so no leaf is linked below
+ * them meanwhile, and the Node that moves down is marked as shrinking, so
+ * searches that pass it start over. Its inner link is moved before it
+ * goes under its child, so the links never form a cycle. Only the thread
+ * that rebalances may call it.
+ * 
+ * @param pParent The Node holding the link, or NULL for the root link.
+ * @param pLink The link to the root Node of the subtree.
+ * @param left true to rotate to the left, false to the right.
+ * @return The new root Node of the subtree.
+*/
+static ConcurrentNode* rotateConcurrent(ConcurrentNode* pParent, _Atomic(ConcurrentNode*)* pLink,
+                                        bool left){
+    ConcurrentNode* pNode = atomic_load_explicit(pLink, memory_order_acquire);
+    _Atomic(ConcurrentNode*)* pOuter = left ? &pNode->rightChild : &pNode->leftChild;
+    ConcurrentNode* pChild = atomic_load_explicit(pOuter, memory_order_acquire);
+    _Atomic(ConcurrentNode*)* pInner = left ? &pChild->leftChild : &pChild->rightChild;
+
+    if (pParent != NULL)
+        lockConcurrentNode(pParent);
+    lockConcurrentNode(pNode);
+    lockConcurrentNode(pChild);
+
+    unsigned int version = atomic_fetch_or_explicit(&pNode->version, CONCURRENT_SHRINKING,
+                                                    memory_order_relaxed);
+    atomic_store_explicit(pOuter, atomic_load_explicit(pInner, memory_order_acquire),
+                          memory_order_release);
+    atomic_store_explicit(pInner, pNode, memory_order_release);
+    atomic_store_explicit(pLink, pChild, memory_order_release);
+    atomic_store_explicit(&pNode->version, version + CONCURRENT_CHANGE, memory_order_release);
+
+    updateConcurrentHeight(pNode);
+    updateConcurrentHeight(pChild);
+    unlockConcurrentNode(pChild);
+    unlockConcurrentNode(pNode);
+    if (pParent != NULL)
+        unlockConcurrentNode(pParent);
+    return pChild;
+}
+
+/**
+ * Restores the AVL property of a subtree of the ConcurrentTree, like
+ * rebalance.
+ * 
+ * @param pParent The Node holding the link, or NULL for the root link.
+ * @param pLink The link to the root Node of the subtree.
+ * @return The new root Node of the subtree.
+*/
+static ConcurrentNode* rebalanceConcurrent(ConcurrentNode* pParent, _Atomic(ConcurrentNode*)* pLink){
+    ConcurrentNode* pNode = atomic_load_explicit(pLink, memory_order_acquire);
+    ConcurrentNode* pLeft = atomic_load_explicit(&pNode->leftChild, memory_order_acquire);
+    ConcurrentNode* pRight = atomic_load_explicit(&pNode->rightChild, memory_order_acquire);
+
+    if (getConcurrentHeight(pLeft) > getConcurrentHeight(pRight) + 1){
+        if (getConcurrentHeight(atomic_load_explicit(&pLeft->leftChild, memory_order_acquire))
+            < getConcurrentHeight(atomic_load_explicit(&pLeft->rightChild, memory_order_acquire)))
+            rotateConcurrent(pNode, &pNode->leftChild, true);
+        return rotateConcurrent(pParent, pLink, false);
+    }
+    if (getConcurrentHeight(pRight) > getConcurrentHeight(pLeft) + 1){
+        if (getConcurrentHeight(atomic_load_explicit(&pRight->rightChild, memory_order_acquire))
+            < getConcurrentHeight(atomic_load_explicit(&pRight->leftChild, memory_order_acquire)))
+            rotateConcurrent(pNode, &pNode->rightChild, false);
+        return rotateConcurrent(pParent, pLink, true);
+    }
+    updateConcurrentHeight(pNode);
+    return pNode;
+}
+
+/**
+ * Walks the path from a new leaf back towards the root like retraceArena,
+ * updating the heights and rotating unbalanced subtrees. Only the thread
+ * that rebalances may call it, so no other thread rotates and the path
+ * found from the root is exact.
+ * 
+ * @param pTree A pointer to the ConcurrentTree.
+ * @param pLeaf The new leaf.
+*/
+static void retraceConcurrent(ConcurrentTree* pTree, ConcurrentNode* pLeaf){
+    int depth = 0;
+    ConcurrentNode* pNode = atomic_load_explicit(&pTree->root, memory_order_acquire);
+
+    while (pNode != pLeaf){
+        if (depth == pTree->pathCapacity){
+            pTree->pathCapacity = depth == 0 ? CONCURRENT_PATH_SIZE : depth * 2;
+            pTree->pPath = (ConcurrentNode**) trackedRealloc(pTree->pPath,
+                                                            pTree->pathCapacity * sizeof(ConcurrentNode*));
+            if (pTree->pPath == NULL)
+                OutofStorage();
+        }
+        pTree->pPath[depth++] = pNode;
+        pNode = atomic_load_explicit(getConcurrentLink(pNode, pLeaf->data), memory_order_acquire);
+    }
+
+    for (int i = depth - 1; i >= 0; i--){
+        ConcurrentNode* pParent = i > 0 ? pTree->pPath[i - 1] : NULL;
+        _Atomic(ConcurrentNode*)* pLink = pParent == NULL ? &pTree->root
+                                        : getConcurrentLink(pParent, pTree->pPath[i]->data);
+        int oldHeight = pTree->pPath[i]->height;
+
+        if (rebalanceConcurrent(pParent, pLink)->height == oldHeight)
+            break;
+    }
+}
+
+/**
+ * Retraces the pending leaves of the ConcurrentTree, unless another thread
+ * is doing so already. That thread looks at the pending list again after
+ * it gives up the flag, so no leaf is left behind and no thread waits.
+ * 
+ * @param pTree A pointer to the ConcurrentTree.
+*/
+static void rebalanceConcurrentTree(ConcurrentTree* pTree){
+    while (atomic_load(&pTree->pending) != NULL && !atomic_exchange(&pTree->rebalancing, true)){
+        ConcurrentNode* pLeaf;
+        while ((pLeaf = atomic_exchange(&pTree->pending, NULL)) != NULL)
+            for (; pLeaf != NULL; pLeaf = pLeaf->pNextPending)
+                retraceConcurrent(pTree, pLeaf);
+        atomic_store(&pTree->rebalancing, false);
+    }
+}
+
+/**
+ * Insert data to the ConcurrentTree. Any number of threads may insert,
+ * erase and find at the same time. A key that is already there only has
+ * its count increased, without a lock. A new key is linked as a leaf
+ * under the lock of its parent Node alone, so inserts into different
+ * parts of the Tree do not wait for each other. A leaf that may make the
+ * Tree higher is then retraced like in insert, so keys that arrive in
+ * order keep the Tree logarithmic.
+ * 
+ * @param pData A pointer to the data to be added to the ConcurrentTree.
+ * @param pTree A pointer to the ConcurrentTree which the data to be added.
+*/
+void insertConcurrent(TreeData* pData, ConcurrentTree* pTree){
+    TreeData data = *pData;
+    ConcurrentNode* pNew = NULL;
+
+    while (true){
+        ConcurrentNode* pParent;
+        unsigned int version;
+        ConcurrentNode* pNode = searchConcurrent(data, pTree, &pParent, &version);
+
+        if (pNode != NULL){
+            atomic_fetch_add_explicit(&pNode->count, 1, memory_order_relaxed);
+            trackedFree(pNew);
+            return;
+        }
+        if (pNew == NULL)
+            pNew = createConcurrentNode(data);
+
+        if (pParent == NULL){
+            ConcurrentNode* pEmpty = NULL;
+            if (atomic_compare_exchange_strong_explicit(&pTree->root, &pEmpty, pNew,
+                                                        memory_order_release,
+                                                        memory_order_relaxed))
+                return;
+            continue;
+        }
+
+        _Atomic(ConcurrentNode*)* pLink = getConcurrentLink(pParent, data);
+        _Atomic(ConcurrentNode*)* pSibling = pLink == &pParent->leftChild
+                                             ? &pParent->rightChild : &pParent->leftChild;
+        lockConcurrentNode(pParent);
+        /* The parent may have moved down, or another leaf taken the link. */
+        if (!hasConcurrentVersion(pParent, version)
+            || atomic_load_explicit(pLink, memory_order_relaxed) != NULL){
+            unlockConcurrentNode(pParent);
+            continue;
+        }
+        /* Release pairs with the acquire loads of the searches, so the key
+           of the Node is seen before the Node is read. */
+        atomic_store_explicit(pLink, pNew, memory_order_release);
+        bool higher = atomic_load_explicit(pSibling, memory_order_relaxed) == NULL;
+        unlockConcurrentNode(pParent);
+
+        /* With a sibling the height of the parent does not change. */
+        if (higher){
+            pNew->pNextPending = atomic_load(&pTree->pending);
+            while (!atomic_compare_exchange_weak(&pTree->pending, &pNew->pNextPending, pNew))
+                ;
+            rebalanceConcurrentTree(pTree);
+        }
+        return;
+    }
+}
+
+/**
+ * Removes one copy of the data from the ConcurrentTree. The count is
+ * decreased with a compare and swap, so it never drops below zero when
+ * several threads erase the same key. The Node stays in the Tree when the
+ * count reaches zero, until rebuildConcurrentTree.
+ * 
+ * @param pData A pointer to the data to be removed.
+ * @param pTree A pointer to the ConcurrentTree which the data to be removed from.
+ * @return true if a copy of the data was found and removed.
+*/
+bool eraseConcurrent(TreeData* pData, ConcurrentTree* pTree){
+    ConcurrentNode* pNode = findConcurrentNode(*pData, pTree);
+    if (pNode == NULL)
+        return false;
+
+    int count = atomic_load_explicit(&pNode->count, memory_order_relaxed);
+    while (count > 0)
+        if (atomic_compare_exchange_weak_explicit(&pNode->count, &count, count - 1,
+                                                  memory_order_relaxed, memory_order_relaxed))
+            return true;
+    return false;
+}
+
+/**
+ * Counts the copies of the data in the ConcurrentTree. The search takes
+ * no lock and writes nothing, so readers do not slow each other down.
+ * 
+ * @param pData A pointer to the data to look for.
+ * @param pTree A pointer to the ConcurrentTree to search.
+ * @return The count of the data, or 0 if it is not in the Tree.
+*/
+int findConcurrent(TreeData* pData, ConcurrentTree* pTree){
+    ConcurrentNode* pNode = findConcurrentNode(*pData, pTree);
+    return pNode == NULL ? 0 : atomic_load_explicit(&pNode->count, memory_order_relaxed);
+}
+
+/**
+ * Links the Nodes of a sorted range into a perfectly balanced subtree,
+ * like linkBalanced.
+ * 
+ * @param pNodes The Nodes in key order.
+ * @param low The first Node of the range.
+ * @param high One past the last Node of the range.
+ * @return The root of the subtree, or NULL for an empty range.
+*/
+static ConcurrentNode* linkConcurrentBalanced(ConcurrentNode** pNodes, int low, int high){
+    if (low >= high)
+        return NULL;
+
+    int mid = low + (high - low) / 2;
+    ConcurrentNode* pRoot = pNodes[mid];
+    atomic_store_explicit(&pRoot->leftChild, linkConcurrentBalanced(pNodes, low, mid),
+                          memory_order_relaxed);
+    atomic_store_explicit(&pRoot->rightChild, linkConcurrentBalanced(pNodes, mid + 1, high),
+                          memory_order_relaxed);
+    updateConcurrentHeight(pRoot);
+    return pRoot;
+}
+
+/**
+ * Frees the Nodes whose count dropped to zero and links the others into a
+ * perfectly balanced Tree. The Tree stays balanced without it, so this
+ * only reclaims the Nodes of erased keys. No thread may use the Tree while
+ * it is rebuilt.
+ * 
+ * @param pTree A pointer to the ConcurrentTree.
+ * @return The number of Nodes kept.
+*/
+int rebuildConcurrentTree(ConcurrentTree* pTree){
+    ConcurrentNode** pNodes = NULL;
+    ConcurrentNode** pStack = NULL;
+    int capacity = 0, stackCapacity = 0;
+    int kept = 0, top = 0;
+    ConcurrentNode* pCurr = atomic_load(&pTree->root);
+
+    while (pCurr != NULL || top > 0){
+        while (pCurr != NULL){
+            if (top == stackCapacity){
+                stackCapacity = stackCapacity == 0 ? 64 : stackCapacity * 2;
+                pStack = (ConcurrentNode**) trackedRealloc(pStack,
+                                                           stackCapacity * sizeof(ConcurrentNode*));
+                if (pStack == NULL)
+                    OutofStorage();
+            }
+            pStack[top++] = pCurr;
+            pCurr = atomic_load_explicit(&pCurr->leftChild, memory_order_relaxed);
+        }
+
+        ConcurrentNode* pNode = pStack[--top];
+        pCurr = atomic_load_explicit(&pNode->rightChild, memory_order_relaxed);
+        if (atomic_load_explicit(&pNode->count, memory_order_relaxed) == 0){
+            trackedFree(pNode);
+            continue;
+        }
+        if (kept == capacity){
+            capacity = capacity == 0 ? 1024 : capacity * 2;
+            pNodes = (ConcurrentNode**) trackedRealloc(pNodes, capacity * sizeof(ConcurrentNode*));
+            if (pNodes == NULL)
+                OutofStorage();
+        }
+        pNodes[kept++] = pNode;
+    }
+
+    atomic_store(&pTree->root, linkConcurrentBalanced(pNodes, 0, kept));
+    trackedFree(pNodes);
+    trackedFree(pStack);
+    return kept;
+}
+
+/**
+ * Deallocate the ConcurrentTree with every Node in it. The Nodes are
+ * freed while the Tree is flattened by right rotations, as in destroyTree.
+ * No thread may use the Tree while it is destroyed.
+ * 
+ * @param pTree A pointer to the ConcurrentTree to be deallocated.
+*/
+void destroyConcurrentTree(ConcurrentTree* pTree){
+    ConcurrentNode* pNode = atomic_load(&pTree->root);
+
+    while (pNode != NULL){
+        ConcurrentNode* pLeft = atomic_load_explicit(&pNode->leftChild, memory_order_relaxed);
+        if (pLeft != NULL){
+            atomic_store_explicit(&pNode->leftChild,
+                                  atomic_load_explicit(&pLeft->rightChild, memory_order_relaxed),
+                                  memory_order_relaxed);
+            atomic_store_explicit(&pLeft->rightChild, pNode, memory_order_relaxed);
+            pNode = pLeft;
+        } else {
+            ConcurrentNode* pRight = atomic_load_explicit(&pNode->rightChild, memory_order_relaxed);
+            trackedFree(pNode);
+            pNode = pRight;
+        }
+    }
+    trackedFree(pTree->pPath);
+    trackedFree(pTree);
+}
+
+/**
+ * Creates an empty PersistentTree.
+ * 
+ * @return A pointer to the new version.
+*/
+PersistentTree* createPersistentTree(){
+    PersistentTree* pTree = (PersistentTree*) trackedCalloc(1, sizeof(PersistentTree));
+    if (pTree == NULL)
+        OutofStorage();
+    return pTree;
+}
+
+/**
+ * Adds a link to a PersistentNode.
+ * 
+ * @param pNode The Node, or NULL.
+*/
+static void retainPersistentNode(PersistentNode* pNode){
+    if (pNode != NULL)
+        atomic_fetch_add_explicit(&pNode->refs, 1, memory_order_relaxed);
+}
+
+/**
+ * Drops a link to a PersistentNode. The Node is freed with the last link,
+ * and then drops its links to its children in turn. A Tree of AVL height
+ * keeps the recursion short.
+ * 
+ * @param pNode The Node, or NULL.
+*/
+static void releasePersistentNode(PersistentNode* pNode){
+    if (pNode == NULL || atomic_fetch_sub_explicit(&pNode->refs, 1, memory_order_acq_rel) != 1)
+        return;
+    releasePersistentNode(pNode->leftChild);
+    releasePersistentNode(pNode->rightChild);
+    trackedFree(pNode);
+}
+
+/**
+ * Takes a snapshot of a version in constant time. The snapshot shares
+ * every Node with the version, and later changes to either one copy the
+ * Nodes they touch instead of changing the shared ones. The snapshot may
+ * be read and released by another thread, but it must be taken by the
+ * thread that writes to the version.
+ * 
+ * @param pTree A pointer to the version.
+ * @return A pointer to the new version, to be released with releasePersistentTree.
+*/
+PersistentTree* snapshotPersistentTree(PersistentTree* pTree){
+    PersistentTree* pSnapshot = (PersistentTree*) trackedMalloc(sizeof(PersistentTree));
+    if (pSnapshot == NULL)
+        OutofStorage();
+    *pSnapshot = *pTree;
+    retainPersistentNode(pTree->root);
+    return pSnapshot;
+}
+
+/**
+ * Finds the Node that holds the given data in a version.
+ * 
+ * @param pData A pointer to the data to look for.
+ * @param pTree A pointer to the version to search.
+ * @return A pointer to the Node, or NULL if the data is not in the
+ * version. The Node must not be used after the version is changed or
+ * released.
+*/
+const PersistentNode* findPersistent(TreeData* pData, PersistentTree* pTree){
+    const PersistentNode* pCurr = pTree->root;
+
+    while (pCurr != NULL && pCurr->data != *pData)
+        pCurr = pCurr->data > *pData ? pCurr->leftChild : pCurr->rightChild;
+    return pCurr;
+}
+
+/**
+ * Creates a new PersistentNode holding one copy of the data.
+ * 
+ * @param data The key of the new Node.
+ * @return A pointer to the new PersistentNode, with one link.
+*/
+static PersistentNode* createPersistentNode(TreeData data){
+    PersistentNode* pNode = (PersistentNode*) trackedMalloc(sizeof(PersistentNode));
+    if (pNode == NULL)
+        OutofStorage();
+    pNode->data = data;
+    pNode->count = 1;
+    pNode->height = 1;
+    atomic_init(&pNode->refs, 1);
+    pNode->leftChild = NULL;
+    pNode->rightChild = NULL;
+    return pNode;
+}
+
+/**
+ * Makes the Node behind a link safe to change. A Node with a single link
+ * belongs to the version being changed and is returned as it is. A shared
+ * Node is copied: the copy links to the same children, and the link moves
+ * from the original to the copy.
+ * 
+ * @param pNode The Node behind a link of a Node that is safe to change.
+ * @return The Node to store in the link, safe to change.
+*/
+static PersistentNode* ownPersistentNode(PersistentNode* pNode){
+    if (atomic_load_explicit(&pNode->refs, memory_order_acquire) == 1)
+        return pNode;
+
+    PersistentNode* pCopy = (PersistentNode*) trackedMalloc(sizeof(PersistentNode));
+    if (pCopy == NULL)
+        OutofStorage();
+    pCopy->data = pNode->data;
+    pCopy->count = pNode->count;
+    pCopy->height = pNode->height;
+    atomic_init(&pCopy->refs, 1);
+    pCopy->leftChild = pNode->leftChild;
+    pCopy->rightChild = pNode->rightChild;
+    retainPersistentNode(pCopy->leftChild);
+    retainPersistentNode(pCopy->rightChild);
+    releasePersistentNode(pNode);
+    return pCopy;
+}
+
+static int getPersistentNodeHeight(PersistentNode* pNode){
+    return pNode == NULL ? 0 : pNode->height;
+}
+
+static void updatePersistentHeight(PersistentNode* pNode){
+    int left = getPersistentNodeHeight(pNode->leftChild);
+    int right = getPersistentNodeHeight(pNode->rightChild);
+    pNode->height = (left > right ? left : right) + 1;
+}
+
+/**
+ * Rotates the subtree to the left, copying the right child first if it is
+ * shared.
+ * 
+ * @param pNode The root Node of the subtree, safe to change.
+ * @return The new root Node of the subtree.
+*/
+static PersistentNode* rotatePersistentLeft(PersistentNode* pNode){
+    PersistentNode* pRight = ownPersistentNode(pNode->rightChild);
+    pNode->rightChild = pRight->leftChild;
+    pRight->leftChild = pNode;
+    updatePersistentHeight(pNode);
+    updatePersistentHeight(pRight);
+    return pRight;
+}
+
+/**
+ * Rotates the subtree to the right, copying the left child first if it is
+ * shared.
+ * 
+ * @param pNode The root Node of the subtree, safe to change.
+ * @return The new root Node of the subtree.
+*/
+static PersistentNode* rotatePersistentRight(PersistentNode* pNode){
+    PersistentNode* pLeft = ownPersistentNode(pNode->leftChild);
+    pNode->leftChild = pLeft->rightChild;
+    pLeft->rightChild = pNode;
+    updatePersistentHeight(pNode);
+    updatePersistentHeight(pLeft);
+    return pLeft;
+}
+
+/**
+ * Updates the height of a Node and restores the AVL property of its
+ * subtree, like rebalance. After an erase the taller child is not on the
+ * changed path and may be shared, so the rotations copy what they change.
+ * 
+ * @param pNode The root Node of the subtree, safe to change.
+ * @return The new root Node of the subtree.
+*/
+static PersistentNode* rebalancePersistent(PersistentNode* pNode){
+    int balance = getPersistentNodeHeight(pNode->leftChild)
+                  - getPersistentNodeHeight(pNode->rightChild);
+
+    updatePersistentHeight(pNode);
+    if (balance > 1){
+        PersistentNode* pLeft = pNode->leftChild;
+        if (getPersistentNodeHeight(pLeft->leftChild) < getPersistentNodeHeight(pLeft->rightChild))
+            pNode->leftChild = rotatePersistentLeft(ownPersistentNode(pLeft));
+        return rotatePersistentRight(pNode);
+    }
+    if (balance < -1){
+        PersistentNode* pRight = pNode->rightChild;
+        if (getPersistentNodeHeight(pRight->rightChild) < getPersistentNodeHeight(pRight->leftChild))
+            pNode->rightChild = rotatePersistentRight(ownPersistentNode(pRight));
+        return rotatePersistentLeft(pNode);
+    }
+    return pNode;
+}
+
+/**
+ * Inserts a key into a subtree, copying the shared Nodes on the path.
+ * 
+ * @param pNode The root Node of the subtree, or NULL.
+ * @param data The key to insert.
+ * @param pTree The version being changed, whose size is updated.
+ * @return The new root Node of the subtree.
+*/
+static PersistentNode* insertPersistentNode(PersistentNode* pNode, TreeData data,
+                                            PersistentTree* pTree){
+    if (pNode == NULL){
+        pTree->size++;
+        return createPersistentNode(data);
+    }
+
+    pNode = ownPersistentNode(pNode);
+    if (pNode->data > data)
+        pNode->leftChild = insertPersistentNode(pNode->leftChild, data, pTree);
+    else if (pNode->data < data)
+        pNode->rightChild = insertPersistentNode(pNode->rightChild, data, pTree);
+    else {
+        pNode->count++;
+        return pNode;
+    }
+    return rebalancePersistent(pNode);
+}
+
+/**
+ * Insert data to a version of the PersistentTree. Only the Nodes on the
+ * path to the key are changed. Those that are shared with a snapshot are
+ * copied, so the snapshot keeps seeing the Tree as it was, and those that
+ * belong to this version alone are changed in place.
+ * 
+ * @param pData A pointer to the data to be added.
+ * @param pTree A pointer to the version, which becomes the new version.
+*/
+void insertPersistent(TreeData* pData, PersistentTree* pTree){
+    pTree->root = insertPersistentNode(pTree->root, *pData, pTree);
+    pTree->total++;
+}
+
+/**
+ * Removes the smallest Node of a subtree.
+ * 
+ * @param pNode The root Node of the subtree, not NULL.
+ * @param pData Set to the key of the removed Node.
+ * @param pCount Set to the count of the removed Node.
+ * @return The new root Node of the subtree.
+*/
+static PersistentNode* removePersistentMin(PersistentNode* pNode, TreeData* pData, int* pCount){
+    pNode = ownPersistentNode(pNode);
+    if (pNode->leftChild == NULL){
+        PersistentNode* pRight = pNode->rightChild;
+        *pData = pNode->data;
+        *pCount = pNode->count;
+        pNode->rightChild = NULL;
+        releasePersistentNode(pNode);
+        return pRight;
+    }
+    pNode->leftChild = removePersistentMin(pNode->leftChild, pData, pCount);
+    return rebalancePersistent(pNode);
+}
+
+/**
+ * Removes one copy of a key that is in the subtree, copying the shared
+ * Nodes on the path.
+ * 
+ * @param pNode The root Node of the subtree.
+ * @param data The key to remove.
+ * @param pTree The version being changed, whose size is updated.
+ * @return The new root Node of the subtree.
+*/
+static PersistentNode* erasePersistentNode(PersistentNode* pNode, TreeData data,
+                                           PersistentTree* pTree){
+    pNode = ownPersistentNode(pNode);
+    if (pNode->data > data){
+        pNode->leftChild = erasePersistentNode(pNode->leftChild, data, pTree);
+    } else if (pNode->data < data){
+        pNode->rightChild = erasePersistentNode(pNode->rightChild, data, pTree);
+    } else if (pNode->count > 1){
+        pNode->count--;
+        return pNode;
+    } else if (pNode->leftChild == NULL || pNode->rightChild == NULL){
+        PersistentNode* pChild = pNode->leftChild != NULL ? pNode->leftChild : pNode->rightChild;
+        pNode->leftChild = NULL;
+        pNode->rightChild = NULL;
+        releasePersistentNode(pNode);
+        pTree->size--;
+        return pChild;
+    } else {
+        pNode->rightChild = removePersistentMin(pNode->rightChild, &pNode->data, &pNode->count);
+        pTree->size--;
+    }
+    return rebalancePersistent(pNode);
+}
+
+/**
+ * Removes one copy of the data from a version of the PersistentTree. As
+ * with insertPersistent, snapshots are not changed. Nothing is copied when
+ * the data is not in the version.
+ * 
+ * @param pData A pointer to the data to be removed.
+ * @param pTree A pointer to the version, which becomes the new version.
+ * @return true if the data was found in the version.
+*/
+bool erasePersistent(TreeData* pData, PersistentTree* pTree){
+    if (findPersistent(pData, pTree) == NULL)
+        return false;
+    pTree->root = erasePersistentNode(pTree->root, *pData, pTree);
+    pTree->total--;
+    return true;
+}
+
+/**
+ * Calls the visit function on every Node of a version in order.
+ * 
+ * @param pTree A pointer to the version.
+ * @param visit The function called with each Node and the context.
+ * @param pContext A pointer passed to every call of visit.
+*/
+void visitPersistent(PersistentTree* pTree,
+                     void (*visit)(const PersistentNode* pNode, void* pContext), void* pContext){
+    const PersistentNode* stack[PERSISTENT_MAX_HEIGHT];
+    int top = 0;
+    const PersistentNode* pCurr = pTree->root;
+
+    while (pCurr != NULL || top > 0){
+        while (pCurr != NULL){
+            stack[top++] = pCurr;
+            pCurr = pCurr->leftChild;
+        }
+        pCurr = stack[--top];
+        visit(pCurr, pContext);
+        pCurr = pCurr->rightChild;
+    }
+}
+
+/**
+ * Gets the number of distinct keys in a version.
+ * 
+ * @param pTree A pointer to the version.
+ * @return The number of Nodes.
+*/
+int getPersistentSize(PersistentTree* pTree){
+    return pTree->size;
+}
+
+/**
+ * Gets the number of copies of data in a version, counting duplicates.
+ * 
+ * @param pTree A pointer to the version.
+ * @return The sum of the counts of all Nodes.
+*/
+long long getPersistentTotal(PersistentTree* pTree){
+    return pTree->total;
+}
+
+/**
+ * Gets the height of a version.
+ * 
+ * @param pTree A pointer to the version.
+ * @return The height, 0 for an empty version.
+*/
+int getPersistentHeight(PersistentTree* pTree){
+    return getPersistentNodeHeight(pTree->root);
+}
+
+/**
+ * Releases a version of the PersistentTree. The Nodes no other version
+ * links to are freed, and the shared ones are left to the versions that
+ * still hold them.
+ * 
+ * @param pTree A pointer to the version to be released.
+*/
+void releasePersistentTree(PersistentTree* pTree){
+    releasePersistentNode(pTree->root);
+    trackedFree(pTree);
+}
+
+#ifndef TREE_NO_MAIN
+void printNode(Node* pNode, void* pContext){
+    printf("%d x%d ", *(pNode->data), pNode->count);
+}
+
+void printArenaNode(ArenaNode* pNode, void* pContext){
+    printf(" %d x%d", pNode->data, pNode->count);
+}
+
+void printPersistentNode(const PersistentNode* pNode, void* pContext){
+    printf(" %d x%d", pNode->data, pNode->count);
+}
+
+int main(){
+    AllocStats before = getAllocStats();
+    Tree* tree = createTree();
+    int values[] = {5,3,6,6,4};
+    for (int i = 0; i < 5; i++)
+    {
+        insert(&(values[i]), tree);
+    }
+
+    TreeIterator* iter = createTreeIterator(tree);
+    printf("In order: ");
+    while (hasNext(iter))
+        printNode(nextNode(iter), NULL);
+    deleteTreeIterator(iter);
+
+    int low = 4, high = 5;
+    printf("\nBetween %d and %d: ", low, high);
+    rangeQuery(tree, &low, &high, printNode, NULL);
+    printf("\n");
+
+    int key = 6;
+    printf("Rank of %d: %lld of %lld, median %d, p99 %d\n", key, getRank(&key, tree),
+           getTotalCount(tree), *(percentile(50, tree)->data), *(percentile(99, tree)->data));
+
+    const char* pPath = "tree.map";
+    MappedTree mapped;
+    if (!saveTree(tree, pPath) || !openMappedTree(&mapped, pPath)){
+        fprintf(stderr, "Could not save and map the Tree\n");
+        return EXIT_FAILURE;
+    }
+    printf("Mapped %d Nodes:", getMappedTreeSize(&mapped));
+    for (int i = 0; i < 5; i++){
+        const MappedTreeNode* pNode = findMappedTree(&values[i], &mapped);
+        if (pNode == NULL || pNode->count != find(&values[i], tree)->count){
+            fprintf(stderr, "\nThe mapped Tree differs from the saved one\n");
+            return EXIT_FAILURE;
+        }
+        printf(" %d x%d", pNode->data, pNode->count);
+    }
+    printf("\n");
+    closeMappedTree(&mapped);
+    remove(pPath);
+
+    /* A capacity of one slot, so the Node array has to grow. */
+    ArenaTree* pArena = createArenaTree(1);
+    for (int i = 0; i < 5; i++)
+        insertArena(&values[i], pArena);
+    eraseArena(&values[0], pArena);
+    printf("Arena without %d:", values[0]);
+    visitArena(pArena, printArenaNode, NULL);
+    printf(" (%d Nodes, %zu bytes)\n", getArenaSize(pArena), getArenaMemory(pArena));
+    destroyArenaTree(pArena);
+
+    ConcurrentTree* pConcurrent = createConcurrentTree();
+    for (int i = 0; i < 5; i++)
+        insertConcurrent(&values[i], pConcurrent);
+    eraseConcurrent(&values[1], pConcurrent);
+    printf("Concurrent counts:");
+    for (int i = 0; i < 5; i++)
+        printf(" %d x%d", values[i], findConcurrent(&values[i], pConcurrent));
+    printf(" (%d Nodes after rebuild)\n", rebuildConcurrentTree(pConcurrent));
+    destroyConcurrentTree(pConcurrent);
+
+    PersistentTree* pVersion = createPersistentTree();
+    for (int i = 0; i < 5; i++)
+        insertPersistent(&values[i], pVersion);
+    PersistentTree* pSnapshot = snapshotPersistentTree(pVersion);
+    erasePersistent(&values[0], pVersion);
+    insertPersistent(&low, pVersion);
+    printf("Persistent version:");
+    visitPersistent(pVersion, printPersistentNode, NULL);
+    printf(", snapshot:");
+    visitPersistent(pSnapshot, printPersistentNode, NULL);
+    printf("\n");
+    releasePersistentTree(pSnapshot);
+    releasePersistentTree(pVersion);
+
+    destroyTree(tree);
+    if (!checkNoLeaks(stderr, "Tree demo", &before))
+        return EXIT_FAILURE;
     return 0;
 }
+#endif
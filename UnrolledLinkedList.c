@@ -0,0 +1,804 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "TrackedAlloc.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define UNROLLED_X86_KERNELS
+#endif
+
+/**
+ * An unrolled variant of the LinkedList in SinglyLinkedList.c. Every
+ * Node is one 64 byte cache line holding up to UNROLLED_CAPACITY values,
+ * so a traversal touches one cache line per block of values instead of
+ * one per value.
+ * 
+ * Defining UNROLLED_NODE_SIZE as a larger multiple of 64, such as 4096,
+ * turns the list into a contiguous block container: each Node then holds
+ * about a page of values, which the scan functions search and aggregate
+ * with SSE2 or AVX2 kernels. Inserting in the middle or at the front
+ * moves up to a whole block, so large Nodes suit lists that are mostly
+ * appended to and scanned.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+typedef int ListData;
+typedef struct _UnrolledNode UnrolledNode;
+
+#ifndef UNROLLED_NODE_SIZE
+#define UNROLLED_NODE_SIZE 64
+#endif
+#define UNROLLED_CAPACITY ((int) ((UNROLLED_NODE_SIZE - sizeof(void*) - sizeof(int)) \
+                                  / sizeof(ListData)))
+
+typedef struct _UnrolledNode {
+    UnrolledNode* pNext;
+    int count;
+    ListData items[UNROLLED_CAPACITY];
+} UnrolledNode;
+
+_Static_assert(sizeof(UnrolledNode) == UNROLLED_NODE_SIZE,
+               "UnrolledNode must fill a whole number of cache lines");
+
+typedef struct{
+    UnrolledNode* pFirstNode;
+    UnrolledNode* pLastNode;
+    int size;
+} UnrolledList;
+
+/* The instruction sets the scan kernels are written for. */
+typedef enum{
+    eScanScalar = 0,
+    eScanSSE2,
+    eScanAVX2
+} eScanLevel;
+
+/* Kernels that scan the values of one Node. min and max need at least
+   one value, and find returns -1 when the value is not there. */
+typedef struct{
+    eScanLevel level;
+    int (*find)(const ListData* pItems, int n, ListData data);
+    int (*count)(const ListData* pItems, int n, ListData data);
+    ListData (*min)(const ListData* pItems, int n);
+    ListData (*max)(const ListData* pItems, int n);
+    long long (*sum)(const ListData* pItems, int n);
+} ScanKernels;
+
+/* Prototypes:
+UnrolledList* createUnrolledList();
+int getUnrolledSize(UnrolledList* pList);
+void insertUnrolledFront(UnrolledList* pList, ListData data);
+void insertUnrolledBack(UnrolledList* pList, ListData data);
+void insertUnrolledAt(UnrolledList* pList, int pos, ListData data);
+bool removeUnrolledFront(UnrolledList* pList, ListData* pData);
+bool removeUnrolledBack(UnrolledList* pList, ListData* pData);
+bool removeUnrolledAt(UnrolledList* pList, int pos, ListData* pData);
+ListData* getUnrolledAt(UnrolledList* pList, int pos);
+eScanLevel selectUnrolledScan(eScanLevel maxLevel);
+int findUnrolled(UnrolledList* pList, ListData data);
+int countUnrolled(UnrolledList* pList, ListData data);
+bool removeUnrolledValue(UnrolledList* pList, ListData data);
+bool minUnrolled(UnrolledList* pList, ListData* pMin);
+bool maxUnrolled(UnrolledList* pList, ListData* pMax);
+long long sumUnrolled(UnrolledList* pList);
+void printUnrolledList(UnrolledList* pList);
+void destroyUnrolledList(UnrolledList* pList);
+*/
+
+/**
+ * Allocates an empty, cache line aligned Node and exits with a message to
+ * the stderr when no memory is available.
+ * 
+ * @return A pointer to the new Node.
+*/
+UnrolledNode* createUnrolledNode(void){
+    UnrolledNode* pNode = (UnrolledNode*) trackedAlignedAlloc(UNROLLED_NODE_SIZE,
+                                                        UNROLLED_NODE_SIZE);
+    if (pNode == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        exit(EXIT_FAILURE);
+    }
+    pNode->pNext = NULL;
+    pNode->count = 0;
+    return pNode;
+}
+
+/**
+ * Creates an instance of an UnrolledList.
+ * 
+ * @return A pointer to the new UnrolledList instance.
+*/
+UnrolledList* createUnrolledList(){
+    UnrolledList* pList = (UnrolledList*) trackedCalloc(1, sizeof(UnrolledList));
+    if (pList == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        exit(EXIT_FAILURE);
+    }
+    return pList;
+}
+
+/**
+ * Gets the number of values in the UnrolledList.
+ * 
+ * @param pList A pointer to the UnrolledList.
+ * @return The number of values.
+*/
+int getUnrolledSize(UnrolledList* pList){
+    return pList->size;
+}
+
+/**
+ * Insert a value to the front of the UnrolledList. A new Node is only
+ * added when the first Node is full, so front insertion keeps the Nodes
+ * densely packed.
+ * 
+ * @param pList A pointer to the UnrolledList to add the value.
+ * @param data The value to be added.
+*/
+void insertUnrolledFront(UnrolledList* pList, ListData data){
+    UnrolledNode* pNode = pList->pFirstNode;
+
+    if (pNode == NULL || pNode->count == UNROLLED_CAPACITY){
+        pNode = createUnrolledNode();
+        pNode->pNext = pList->pFirstNode;
+        if (pList->pFirstNode == NULL)
+            pList->pLastNode = pNode;
+        pList->pFirstNode = pNode;
+    }
+
+    memmove(&pNode->items[1], &pNode->items[0], pNode->count * sizeof(ListData));
+    pNode->items[0] = data;
+    pNode->count++;
+    pList->size++;
+}
+
+/**
+ * Insert a value to the back of the UnrolledList. This function is
+ * guaranteed to return in constant time.
+ * 
+ * @param pList A pointer to the UnrolledList to add the value.
+ * @param data The value to be added.
+*/
+void insertUnrolledBack(UnrolledList* pList, ListData data){
+    UnrolledNode* pNode = pList->pLastNode;
+
+    if (pNode == NULL || pNode->count == UNROLLED_CAPACITY){
+        pNode = createUnrolledNode();
+        if (pList->pLastNode == NULL)
+            pList->pFirstNode = pNode;
+        else
+            pList->pLastNode->pNext = pNode;
+        pList->pLastNode = pNode;
+    }
+
+    pNode->items[pNode->count++] = data;
+    pList->size++;
+}
+
+/**
+ * Insert a value so that it ends up at the given position. A full Node
+ * is split in half to make room, and the value goes into the half that
+ * covers the position.
+ * 
+ * @param pList A pointer to the UnrolledList to add the value.
+ * @param pos The position of the new value, between 0 and the size.
+ * @param data The value to be added.
+*/
+void insertUnrolledAt(UnrolledList* pList, int pos, ListData data){
+    if (pos <= 0 || pList->pFirstNode == NULL){
+        insertUnrolledFront(pList, data);
+        return;
+    }
+    if (pos >= pList->size){
+        insertUnrolledBack(pList, data);
+        return;
+    }
+
+    UnrolledNode* pNode = pList->pFirstNode;
+    while (pos > pNode->count){
+        pos -= pNode->count;
+        pNode = pNode->pNext;
+    }
+
+    if (pNode->count == UNROLLED_CAPACITY){
+        UnrolledNode* pSplit = createUnrolledNode();
+        int half = UNROLLED_CAPACITY / 2;
+
+        pSplit->count = UNROLLED_CAPACITY - half;
+        memcpy(pSplit->items, &pNode->items[half], pSplit->count * sizeof(ListData));
+        pNode->count = half;
+        pSplit->pNext = pNode->pNext;
+        pNode->pNext = pSplit;
+        if (pList->pLastNode == pNode)
+            pList->pLastNode = pSplit;
+
+        if (pos > half){
+            pos -= half;
+            pNode = pSplit;
+        }
+    }
+
+    memmove(&pNode->items[pos + 1], &pNode->items[pos],
+            (pNode->count - pos) * sizeof(ListData));
+    pNode->items[pos] = data;
+    pNode->count++;
+    pList->size++;
+}
+
+/**
+ * Removes the value at the given index of a Node. Used by removeUnrolledAt
+ * and removeUnrolledValue once they found the Node.
+ * 
+ * @param pList A pointer to the UnrolledList.
+ * @param pPrev The Node before pNode, or NULL if pNode is the first one.
+ * @param pNode The Node holding the value.
+ * @param pos The index of the value in the Node.
+ * @param pData Set to the removed value, unless it is NULL.
+*/
+static void removeFromNode(UnrolledList* pList, UnrolledNode* pPrev, UnrolledNode* pNode,
+                           int pos, ListData* pData){
+    if (pData != NULL)
+        *pData = pNode->items[pos];
+    pNode->count--;
+    memmove(&pNode->items[pos], &pNode->items[pos + 1],
+            (pNode->count - pos) * sizeof(ListData));
+    pList->size--;
+
+    UnrolledNode* pNext = pNode->pNext;
+    if (pNode->count == 0){
+        if (pPrev == NULL)
+            pList->pFirstNode = pNext;
+        else
+            pPrev->pNext = pNext;
+        if (pList->pLastNode == pNode)
+            pList->pLastNode = pPrev;
+        trackedFree(pNode);
+    } else if (pNext != NULL && pNode->count < UNROLLED_CAPACITY / 2
+               && pNode->count + pNext->count <= UNROLLED_CAPACITY){
+        memcpy(&pNode->items[pNode->count], pNext->items, pNext->count * sizeof(ListData));
+        pNode->count += pNext->count;
+        pNode->pNext = pNext->pNext;
+        if (pList->pLastNode == pNext)
+            pList->pLastNode = pNode;
+        trackedFree(pNext);
+    }
+}
+
+/**
+ * Removes the value at the given position. A Node left empty is freed,
+ * and a Node left less than half full is merged with its successor when
+ * both fit in one Node.
+ * 
+ * @param pList A pointer to the UnrolledList to remove the value from.
+ * @param pos The position of the value.
+ * @param pData Set to the removed value, unless it is NULL.
+ * @return false if the position is outside the list.
+*/
+bool removeUnrolledAt(UnrolledList* pList, int pos, ListData* pData){
+    if (pos < 0 || pos >= pList->size)
+        return false;
+
+    UnrolledNode* pPrev = NULL;
+    UnrolledNode* pNode = pList->pFirstNode;
+    while (pos >= pNode->count){
+        pos -= pNode->count;
+        pPrev = pNode;
+        pNode = pNode->pNext;
+    }
+    removeFromNode(pList, pPrev, pNode, pos, pData);
+    return true;
+}
+
+/**
+ * Removes the front value from the UnrolledList.
+ * 
+ * @param pList A pointer to the UnrolledList to remove the value from.
+ * @param pData Set to the removed value, unless it is NULL.
+ * @return false if the list is empty.
+*/
+bool removeUnrolledFront(UnrolledList* pList, ListData* pData){
+    return removeUnrolledAt(pList, 0, pData);
+}
+
+/**
+ * Removes the last value from the UnrolledList. Like removeNodefromBack,
+ * this walks the list to find the predecessor, but it skips a whole Node
+ * per step.
+ * 
+ * @param pList A pointer to the UnrolledList to remove the value from.
+ * @param pData Set to the removed value, unless it is NULL.
+ * @return false if the list is empty.
+*/
+bool removeUnrolledBack(UnrolledList* pList, ListData* pData){
+    return removeUnrolledAt(pList, pList->size - 1, pData);
+}
+
+/**
+ * Gets the value at the given position.
+ * 
+ * @param pList A pointer to the UnrolledList to get the value from.
+ * @param pos The position of the value.
+ * @return A pointer to the value, or NULL if the position is outside the list.
+*/
+ListData* getUnrolledAt(UnrolledList* pList, int pos){
+    if (pos < 0 || pos >= pList->size)
+        return NULL;
+    if (pos >= pList->size - pList->pLastNode->count)
+        return &pList->pLastNode->items[pos - (pList->size - pList->pLastNode->count)];
+
+    UnrolledNode* pNode = pList->pFirstNode;
+    while (pos >= pNode->count){
+        pos -= pNode->count;
+        pNode = pNode->pNext;
+    }
+    return &pNode->items[pos];
+}
+
+static int findScalar(const ListData* pItems, int n, ListData data){
+    for (int i = 0; i < n; i++)
+        if (pItems[i] == data)
+            return i;
+    return -1;
+}
+
+static int countScalar(const ListData* pItems, int n, ListData data){
+    int count = 0;
+    for (int i = 0; i < n; i++)
+        count += pItems[i] == data;
+    return count;
+}
+
+static ListData minScalar(const ListData* pItems, int n){
+    ListData min = pItems[0];
+    for (int i = 1; i < n; i++)
+        if (pItems[i] < min)
+            min = pItems[i];
+    return min;
+}
+
+static ListData maxScalar(const ListData* pItems, int n){
+    ListData max = pItems[0];
+    for (int i = 1; i < n; i++)
+        if (pItems[i] > max)
+            max = pItems[i];
+    return max;
+}
+
+static long long sumScalar(const ListData* pItems, int n){
+    long long sum = 0;
+    for (int i = 0; i < n; i++)
+        sum += pItems[i];
+    return sum;
+}
+
+static const ScanKernels scalarKernels = {
+    eScanScalar, findScalar, countScalar, minScalar, maxScalar, sumScalar
+};
+
+#ifdef UNROLLED_X86_KERNELS
+/* The SSE2 and AVX2 kernels load the values without alignment, since the
+   items of a Node start right after its header. The AVX2 kernels finish
+   the values left over after the last full vector themselves: calling
+   SSE2 code with the upper halves of the registers in use costs a state
+   transition on many CPUs, which is slower than the whole Node. */
+
+__attribute__((target("sse2")))
+static int findSSE2(const ListData* pItems, int n, ListData data){
+    __m128i key = _mm_set1_epi32(data);
+    int i = 0;
+    for (; i + 4 <= n; i += 4){
+        __m128i v = _mm_loadu_si128((const __m128i*) &pItems[i]);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, key)));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+    int found = findScalar(&pItems[i], n - i, data);
+    return found < 0 ? -1 : i + found;
+}
+
+__attribute__((target("sse2")))
+static int countSSE2(const ListData* pItems, int n, ListData data){
+    __m128i key = _mm_set1_epi32(data);
+    __m128i counts = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= n; i += 4){
+        __m128i v = _mm_loadu_si128((const __m128i*) &pItems[i]);
+        counts = _mm_sub_epi32(counts, _mm_cmpeq_epi32(v, key));
+    }
+    int lanes[4];
+    _mm_storeu_si128((__m128i*) lanes, counts);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + countScalar(&pItems[i], n - i, data);
+}
+
+/* SSE2 has no 32-bit min and max, so they are built from a compare. */
+__attribute__((target("sse2")))
+static inline __m128i selectSSE2(__m128i mask, __m128i a, __m128i b){
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+__attribute__((target("sse2")))
+static ListData minSSE2(const ListData* pItems, int n){
+    if (n < 4)
+        return minScalar(pItems, n);
+    __m128i min = _mm_loadu_si128((const __m128i*) pItems);
+    int i = 4;
+    for (; i + 4 <= n; i += 4){
+        __m128i v = _mm_loadu_si128((const __m128i*) &pItems[i]);
+        min = selectSSE2(_mm_cmplt_epi32(v, min), v, min);
+    }
+    ListData lanes[4];
+    _mm_storeu_si128((__m128i*) lanes, min);
+    ListData result = minScalar(lanes, 4);
+    for (; i < n; i++)
+        if (pItems[i] < result)
+            result = pItems[i];
+    return result;
+}
+
+__attribute__((target("sse2")))
+static ListData maxSSE2(const ListData* pItems, int n){
+    if (n < 4)
+        return maxScalar(pItems, n);
+    __m128i max = _mm_loadu_si128((const __m128i*) pItems);
+    int i = 4;
+    for (; i + 4 <= n; i += 4){
+        __m128i v = _mm_loadu_si128((const __m128i*) &pItems[i]);
+        max = selectSSE2(_mm_cmpgt_epi32(v, max), v, max);
+    }
+    ListData lanes[4];
+    _mm_storeu_si128((__m128i*) lanes, max);
+    ListData result = maxScalar(lanes, 4);
+    for (; i < n; i++)
+        if (pItems[i] > result)
+            result = pItems[i];
+    return result;
+}
+
+/* The values are sign extended to 64 bits before adding, so the sum of
+   any number of values can not overflow a lane. */
+__attribute__((target("sse2")))
+static long long sumSSE2(const ListData* pItems, int n){
+    __m128i sums = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= n; i += 4){
+        __m128i v = _mm_loadu_si128((const __m128i*) &pItems[i]);
+        __m128i sign = _mm_srai_epi32(v, 31);
+        sums = _mm_add_epi64(sums, _mm_unpacklo_epi32(v, sign));
+        sums = _mm_add_epi64(sums, _mm_unpackhi_epi32(v, sign));
+    }
+    long long lanes[2];
+    _mm_storeu_si128((__m128i*) lanes, sums);
+    return lanes[0] + lanes[1] + sumScalar(&pItems[i], n - i);
+}
+
+static const ScanKernels sse2Kernels = {
+    eScanSSE2, findSSE2, countSSE2, minSSE2, maxSSE2, sumSSE2
+};
+
+__attribute__((target("avx2")))
+static int findAVX2(const ListData* pItems, int n, ListData data){
+    __m256i key = _mm256_set1_epi32(data);
+    int i = 0;
+    for (; i + 8 <= n; i += 8){
+        __m256i v = _mm256_loadu_si256((const __m256i*) &pItems[i]);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, key)));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+    for (; i < n; i++)
+        if (pItems[i] == data)
+            return i;
+    return -1;
+}
+
+__attribute__((target("avx2")))
+static int countAVX2(const ListData* pItems, int n, ListData data){
+    __m256i key = _mm256_set1_epi32(data);
+    __m256i counts = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= n; i += 8){
+        __m256i v = _mm256_loadu_si256((const __m256i*) &pItems[i]);
+        counts = _mm256_sub_epi32(counts, _mm256_cmpeq_epi32(v, key));
+    }
+    __m128i half = _mm_add_epi32(_mm256_castsi256_si128(counts),
+                                 _mm256_extracti128_si256(counts, 1));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+    int count = _mm_cvtsi128_si32(half);
+    for (; i < n; i++)
+        count += pItems[i] == data;
+    return count;
+}
+
+__attribute__((target("avx2")))
+static ListData minAVX2(const ListData* pItems, int n){
+    ListData result = pItems[0];
+    int i = 0;
+    if (n >= 8){
+        __m256i min = _mm256_loadu_si256((const __m256i*) pItems);
+        for (i = 8; i + 8 <= n; i += 8)
+            min = _mm256_min_epi32(min, _mm256_loadu_si256((const __m256i*) &pItems[i]));
+        __m128i half = _mm_min_epi32(_mm256_castsi256_si128(min),
+                                     _mm256_extracti128_si256(min, 1));
+        half = _mm_min_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+        half = _mm_min_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+        result = _mm_cvtsi128_si32(half);
+    }
+    for (; i < n; i++)
+        if (pItems[i] < result)
+            result = pItems[i];
+    return result;
+}
+
+__attribute__((target("avx2")))
+static ListData maxAVX2(const ListData* pItems, int n){
+    ListData result = pItems[0];
+    int i = 0;
+    if (n >= 8){
+        __m256i max = _mm256_loadu_si256((const __m256i*) pItems);
+        for (i = 8; i + 8 <= n; i += 8)
+            max = _mm256_max_epi32(max, _mm256_loadu_si256((const __m256i*) &pItems[i]));
+        __m128i half = _mm_max_epi32(_mm256_castsi256_si128(max),
+                                     _mm256_extracti128_si256(max, 1));
+        half = _mm_max_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+        half = _mm_max_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+        result = _mm_cvtsi128_si32(half);
+    }
+    for (; i < n; i++)
+        if (pItems[i] > result)
+            result = pItems[i];
+    return result;
+}
+
+__attribute__((target("avx2")))
+static long long sumAVX2(const ListData* pItems, int n){
+    __m256i sums = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= n; i += 8){
+        __m256i v = _mm256_loadu_si256((const __m256i*) &pItems[i]);
+        sums = _mm256_add_epi64(sums, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        sums = _mm256_add_epi64(sums, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i*) lanes, sums);
+    long long sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; i++)
+        sum += pItems[i];
+    return sum;
+}
+
+static const ScanKernels avx2Kernels = {
+    eScanAVX2, findAVX2, countAVX2, minAVX2, maxAVX2, sumAVX2
+};
+#endif
+
+/* The kernels picked by selectUnrolledScan, or NULL before the first scan. */
+static _Atomic(const ScanKernels*) pScanKernels;
+
+/**
+ * Picks the scan kernels for the best instruction set that the CPU
+ * supports, up to the given level. The scan functions call this with
+ * eScanAVX2 on their first use, so it only has to be called to limit the
+ * kernels, for example to compare them.
+ * 
+ * @param maxLevel The highest instruction set to use.
+ * @return The instruction set of the picked kernels.
+*/
+eScanLevel selectUnrolledScan(eScanLevel maxLevel){
+    const ScanKernels* pKernels = &scalarKernels;
+#ifdef UNROLLED_X86_KERNELS
+    __builtin_cpu_init();
+    if (maxLevel >= eScanAVX2 && __builtin_cpu_supports("avx2"))
+        pKernels = &avx2Kernels;
+    else if (maxLevel >= eScanSSE2 && __builtin_cpu_supports("sse2"))
+        pKernels = &sse2Kernels;
+#endif
+    atomic_store(&pScanKernels, pKernels);
+    return pKernels->level;
+}
+
+/**
+ * Gets the scan kernels, picking them on the first call.
+ * 
+ * @return A pointer to the kernels.
+*/
+static const ScanKernels* getScanKernels(void){
+    const ScanKernels* pKernels = atomic_load_explicit(&pScanKernels, memory_order_relaxed);
+    if (pKernels == NULL){
+        selectUnrolledScan(eScanAVX2);
+        pKernels = atomic_load(&pScanKernels);
+    }
+    return pKernels;
+}
+
+/**
+ * Finds the first position of a value in the UnrolledList. Each Node is
+ * searched with the vector kernels, a block of values at a time.
+ * 
+ * @param pList A pointer to the UnrolledList to search.
+ * @param data The value to look for.
+ * @return The position of the value, or -1 if it is not in the list.
+*/
+int findUnrolled(UnrolledList* pList, ListData data){
+    const ScanKernels* pKernels = getScanKernels();
+    int pos = 0;
+
+    for (UnrolledNode* pNode = pList->pFirstNode; pNode != NULL; pNode = pNode->pNext){
+        int found = pKernels->find(pNode->items, pNode->count, data);
+        if (found >= 0)
+            return pos + found;
+        pos += pNode->count;
+    }
+    return -1;
+}
+
+/**
+ * Counts how often a value occurs in the UnrolledList.
+ * 
+ * @param pList A pointer to the UnrolledList to search.
+ * @param data The value to count.
+ * @return The number of occurrences.
+*/
+int countUnrolled(UnrolledList* pList, ListData data){
+    const ScanKernels* pKernels = getScanKernels();
+    int count = 0;
+
+    for (UnrolledNode* pNode = pList->pFirstNode; pNode != NULL; pNode = pNode->pNext)
+        count += pKernels->count(pNode->items, pNode->count, data);
+    return count;
+}
+
+/**
+ * Removes the first occurrence of a value from the UnrolledList. Unlike
+ * removeNode in SinglyLinkedList.h, the search compares a block of values
+ * per step and the Node is found in the same pass.
+ * 
+ * @param pList A pointer to the UnrolledList to remove the value from.
+ * @param data The value to remove.
+ * @return false if the value is not in the list.
+*/
+bool removeUnrolledValue(UnrolledList* pList, ListData data){
+    const ScanKernels* pKernels = getScanKernels();
+    UnrolledNode* pPrev = NULL;
+
+    for (UnrolledNode* pNode = pList->pFirstNode; pNode != NULL; pNode = pNode->pNext){
+        int found = pKernels->find(pNode->items, pNode->count, data);
+        if (found >= 0){
+            removeFromNode(pList, pPrev, pNode, found, NULL);
+            return true;
+        }
+        pPrev = pNode;
+    }
+    return false;
+}
+
+/**
+ * Gets the smallest value in the UnrolledList.
+ * 
+ * @param pList A pointer to the UnrolledList.
+ * @param pMin Set to the smallest value.
+ * @return false if the list is empty.
+*/
+bool minUnrolled(UnrolledList* pList, ListData* pMin){
+    const ScanKernels* pKernels = getScanKernels();
+    if (pList->pFirstNode == NULL)
+        return false;
+
+    ListData min = pKernels->min(pList->pFirstNode->items, pList->pFirstNode->count);
+    for (UnrolledNode* pNode = pList->pFirstNode->pNext; pNode != NULL; pNode = pNode->pNext){
+        ListData nodeMin = pKernels->min(pNode->items, pNode->count);
+        if (nodeMin < min)
+            min = nodeMin;
+    }
+    *pMin = min;
+    return true;
+}
+
+/**
+ * Gets the largest value in the UnrolledList.
+ * 
+ * @param pList A pointer to the UnrolledList.
+ * @param pMax Set to the largest value.
+ * @return false if the list is empty.
+*/
+bool maxUnrolled(UnrolledList* pList, ListData* pMax){
+    const ScanKernels* pKernels = getScanKernels();
+    if (pList->pFirstNode == NULL)
+        return false;
+
+    ListData max = pKernels->max(pList->pFirstNode->items, pList->pFirstNode->count);
+    for (UnrolledNode* pNode = pList->pFirstNode->pNext; pNode != NULL; pNode = pNode->pNext){
+        ListData nodeMax = pKernels->max(pNode->items, pNode->count);
+        if (nodeMax > max)
+            max = nodeMax;
+    }
+    *pMax = max;
+    return true;
+}
+
+/**
+ * Adds up every value in the UnrolledList.
+ * 
+ * @param pList A pointer to the UnrolledList.
+ * @return The sum of the values, 0 for an empty list.
+*/
+long long sumUnrolled(UnrolledList* pList){
+    const ScanKernels* pKernels = getScanKernels();
+    long long sum = 0;
+
+    for (UnrolledNode* pNode = pList->pFirstNode; pNode != NULL; pNode = pNode->pNext)
+        sum += pKernels->sum(pNode->items, pNode->count);
+    return sum;
+}
+
+/**
+ * Prints all the values in the UnrolledList to the stdout.
+ * 
+ * @param pList A pointer to the UnrolledList to be printed.
+*/
+void printUnrolledList(UnrolledList* pList){
+    fprintf(stdout, "List has %2d entries: [", getUnrolledSize(pList));
+    for (UnrolledNode* pNode = pList->pFirstNode; pNode != NULL; pNode = pNode->pNext){
+        for (int i = 0; i < pNode->count; i++)
+            fprintf(stdout, "%2d ", pNode->items[i]);
+        fprintf(stdout, "| ");
+    }
+    fprintf(stdout, "]\n");
+}
+
+/**
+ * Deallocate the UnrolledList and all of its Nodes.
+ * 
+ * @param pList A pointer to the UnrolledList to be deallocated.
+*/
+void destroyUnrolledList(UnrolledList* pList){
+    UnrolledNode* pNode = pList->pFirstNode;
+    while (pNode != NULL){
+        UnrolledNode* pNext = pNode->pNext;
+        trackedFree(pNode);
+        pNode = pNext;
+    }
+    trackedFree(pList);
+}
+
+#ifndef UNROLLED_NO_MAIN
+int main(){
+    AllocStats before = getAllocStats();
+    UnrolledList* pList = createUnrolledList();
+
+    for (int i = 1; i <= 20; i++)
+        insertUnrolledBack(pList, i);
+    printUnrolledList(pList);
+
+    insertUnrolledFront(pList, 0);
+    insertUnrolledAt(pList, 5, 99);
+    printUnrolledList(pList);
+
+    ListData data;
+    removeUnrolledFront(pList, &data);
+    printf("Removed [%2d] from front.\n", data);
+    removeUnrolledBack(pList, &data);
+    printf("Removed [%2d] from back.\n", data);
+    for (int i = 0; i < 8; i++)
+        removeUnrolledAt(pList, 2, NULL);
+    printUnrolledList(pList);
+
+    ListData min, max;
+    minUnrolled(pList, &min);
+    maxUnrolled(pList, &max);
+    printf("Found [15] at %d, [99] at %d. Min %d, max %d, sum %lld.\n",
+           findUnrolled(pList, 15), findUnrolled(pList, 99), min, max, sumUnrolled(pList));
+    removeUnrolledValue(pList, 15);
+    printUnrolledList(pList);
+
+    destroyUnrolledList(pList);
+    if (!checkNoLeaks(stderr, "UnrolledList demo", &before))
+        return EXIT_FAILURE;
+    return 0;
+}
+#endif
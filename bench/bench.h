@@ -0,0 +1,195 @@
+/**
+ * Small timing helpers shared by the benchmark programs.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#ifndef BENCH_H
+#define BENCH_H
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/* Operations that walk a list are sampled instead of run n times. */
+#define BENCH_LINEAR_SAMPLE 1000
+
+typedef enum{
+    eSorted = 0,
+    eRandom
+} eDistribution;
+
+/**
+ * Gets the current value of the monotonic clock.
+ * 
+ * @return The current time in nanoseconds.
+*/
+static inline long long benchNow(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long) ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * Fills an array with pseudo random ints using a fixed seed, so every
+ * run of a benchmark sees the same input.
+ * 
+ * @param pData The array to fill.
+ * @param n The number of elements in the array.
+*/
+static inline void benchFillRandom(int* pData, int n){
+    unsigned int x = 2463534242u;
+    for (int i = 0; i < n; i++){
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        pData[i] = (int) (x >> 1);
+    }
+}
+
+/**
+ * Prints a single benchmark result line.
+ * 
+ * @param name The name of the measured operation.
+ * @param n The number of operations performed.
+ * @param ns The total time taken in nanoseconds.
+*/
+static inline void benchReport(const char* name, long long n, long long ns){
+    printf("%-28s n=%-9lld %10.2f ms %8.2f ns/op\n",
+            name, n, ns / 1e6, n > 0 ? (double) ns / n : 0.0);
+}
+
+/**
+ * Fills an array with keys in the given distribution.
+ * 
+ * @param pKeys The array to fill.
+ * @param n The number of keys.
+ * @param dist The distribution of the keys.
+*/
+static inline void benchFillKeys(int* pKeys, int n, eDistribution dist){
+    if (dist == eRandom){
+        benchFillRandom(pKeys, n);
+        return;
+    }
+    for (int i = 0; i < n; i++)
+        pKeys[i] = i;
+}
+
+/**
+ * Gets the peak resident set size of the process so far.
+ * 
+ * @return The peak RSS in kilobytes.
+*/
+static inline long benchPeakRssKb(void){
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/**
+ * Gets the current resident set size of the process. Unlike the peak, it
+ * drops again when memory is returned to the kernel.
+ * 
+ * @return The RSS in kilobytes, or 0 if it could not be read.
+*/
+static inline long benchRssKb(void){
+    long pages = 0, resident = 0;
+    FILE* pFile = fopen("/proc/self/statm", "r");
+    if (pFile == NULL)
+        return 0;
+    if (fscanf(pFile, "%ld %ld", &pages, &resident) != 2)
+        resident = 0;
+    fclose(pFile);
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/**
+ * Asks the kernel to drop the cached pages of a file, so the next read
+ * comes from the disk as after a restart. This is best effort: pages
+ * still used by another process stay cached.
+ * 
+ * @param pPath The path of the file.
+*/
+static inline void benchDropCache(const char* pPath){
+    int fd = open(pPath, O_RDONLY);
+    if (fd < 0)
+        return;
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+}
+
+/**
+ * Writes an array of ints to a file as raw binary.
+ * 
+ * @param pPath The path of the file.
+ * @param pData The array to write.
+ * @param n The number of elements in the array.
+ * @return 0 on success, -1 if the file could not be written.
+*/
+static inline int benchWriteInts(const char* pPath, const int* pData, int n){
+    FILE* pFile = fopen(pPath, "wb");
+    if (pFile == NULL)
+        return -1;
+    size_t written = fwrite(pData, sizeof(int), n, pFile);
+    return fclose(pFile) == 0 && written == (size_t) n ? 0 : -1;
+}
+
+/**
+ * Reads a file written by benchWriteInts.
+ * 
+ * @param pPath The path of the file.
+ * @param pCount Set to the number of ints read.
+ * @return A new array holding the ints, or NULL if the file could not be read.
+*/
+static inline int* benchReadInts(const char* pPath, int* pCount){
+    FILE* pFile = fopen(pPath, "rb");
+    if (pFile == NULL)
+        return NULL;
+    fseek(pFile, 0, SEEK_END);
+    long bytes = ftell(pFile);
+    fseek(pFile, 0, SEEK_SET);
+
+    int* pData = (int*) malloc(bytes > 0 ? bytes : 1);
+    *pCount = (int) (bytes / sizeof(int));
+    if (pData == NULL || fread(pData, sizeof(int), *pCount, pFile) != (size_t) *pCount){
+        free(pData);
+        pData = NULL;
+    }
+    fclose(pFile);
+    return pData;
+}
+
+/**
+ * Prints the header of the CSV produced by benchReportCsv.
+*/
+static inline void benchCsvHeader(void){
+    printf("structure,operation,distribution,size,ops,total_ns,ns_per_op,"
+           "ops_per_sec,peak_rss_kb\n");
+}
+
+/**
+ * Prints one CSV row for a measurement.
+ * 
+ * @param structure The name of the measured structure.
+ * @param operation The name of the measured operation.
+ * @param dist The key or position distribution.
+ * @param size The number of elements in the structure.
+ * @param ops The number of operations timed.
+ * @param ns The total time taken in nanoseconds.
+*/
+static inline void benchReportCsv(const char* structure, const char* operation,
+                                  eDistribution dist, int size, long long ops,
+                                  long long ns){
+    double nsPerOp = ops > 0 ? (double) ns / ops : 0.0;
+    printf("%s,%s,%s,%d,%lld,%lld,%.2f,%.0f,%ld\n", structure, operation,
+           dist == eSorted ? "sorted" : "random", size, ops, ns, nsPerOp,
+           nsPerOp > 0 ? 1e9 / nsPerOp : 0.0, benchPeakRssKb());
+    fflush(stdout);
+}
+
+#endif
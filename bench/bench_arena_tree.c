@@ -0,0 +1,163 @@
+/**
+ * Compares the balanced Tree, with two allocations per key, against the
+ * ArenaTree, which keeps its Nodes in one array of 16 byte entries. The
+ * memory per key is measured as the growth of the resident set, so the
+ * malloc headers of the pointer Tree are counted as well. The ArenaTree
+ * runs twice, created with the final size and growing from empty. While
+ * it grows, the blocks it moved out of stay in the heap, so its resident
+ * growth is larger than the memory it holds at the end.
+ * Usage: bench_arena_tree [keys]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define KEYS 1000000
+
+/**
+ * Counts the Nodes and copies seen by visitArena.
+ *
+ * @param pNode The visited Node.
+ * @param pContext A pointer to the running total of copies.
+*/
+static void countArenaNode(ArenaNode* pNode, void* pContext){
+    *(long long*) pContext += pNode->count;
+}
+
+/**
+ * Inserts, finds and erases the keys in a pointer Tree.
+ *
+ * @param pKeys The keys.
+ * @param n The number of keys.
+ * @param pFound Set to the number of keys found.
+ * @return The growth of the resident set after the insertions, in kilobytes.
+*/
+static long runPointerTree(int* pKeys, int n, long long* pFound){
+    long rss = benchRssKb();
+    long long start = benchNow();
+    Tree* pTree = createBalancedTree();
+    for (int i = 0; i < n; i++)
+        insert(&pKeys[i], pTree);
+    benchReport("Tree insert", n, benchNow() - start);
+    rss = benchRssKb() - rss;
+
+    start = benchNow();
+    for (int i = 0; i < n; i++)
+        *pFound += find(&pKeys[i], pTree) != NULL;
+    benchReport("Tree find", n, benchNow() - start);
+
+    start = benchNow();
+    for (int i = 0; i < n; i++)
+        erase(&pKeys[i], pTree);
+    benchReport("Tree erase", n, benchNow() - start);
+
+    start = benchNow();
+    destroyTree(pTree);
+    benchReport("destroyTree", 1, benchNow() - start);
+#ifdef __GLIBC__
+    /* Give the freed pages back, so the next run does not reuse them
+       without its resident set growing. */
+    malloc_trim(0);
+#endif
+    return rss;
+}
+
+/**
+ * Inserts, finds and erases the keys in an ArenaTree.
+ *
+ * @param pKeys The keys.
+ * @param n The number of keys.
+ * @param capacity The capacity the ArenaTree is created with.
+ * @param pFound Set to the number of keys found.
+ * @return The growth of the resident set after the insertions, in kilobytes.
+*/
+static long runArenaTree(int* pKeys, int n, int capacity, long long* pFound){
+    long rss = benchRssKb();
+    long long start = benchNow();
+    ArenaTree* pTree = createArenaTree(capacity);
+    for (int i = 0; i < n; i++)
+        insertArena(&pKeys[i], pTree);
+    benchReport(capacity > 0 ? "Arena sized insert" : "Arena insert", n, benchNow() - start);
+    rss = benchRssKb() - rss;
+    printf("%-28s %d Nodes, height %d, %.2f bytes/key allocated\n", "Arena shape",
+           getArenaSize(pTree), getArenaHeight(pTree), (double) getArenaMemory(pTree) / n);
+
+    long long copies = 0;
+    visitArena(pTree, countArenaNode, &copies);
+    if (copies != n)
+        *pFound = -1;
+
+    start = benchNow();
+    for (int i = 0; i < n; i++)
+        *pFound += findArena(&pKeys[i], pTree) != NULL;
+    benchReport("Arena find", n, benchNow() - start);
+
+    start = benchNow();
+    for (int i = 0; i < n; i++)
+        eraseArena(&pKeys[i], pTree);
+    benchReport("Arena erase", n, benchNow() - start);
+    if (getArenaSize(pTree) != 0)
+        *pFound = -1;
+
+    start = benchNow();
+    destroyArenaTree(pTree);
+    benchReport("destroyArenaTree", 1, benchNow() - start);
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+    return rss;
+}
+
+/**
+ * Grows ArenaTrees from every small capacity, where growing by half adds
+ * less than one slot, and checks that they hold every key.
+ *
+ * @return false if a key is missing.
+*/
+static bool checkSmallCapacities(void){
+    for (int capacity = 0; capacity <= 8; capacity++){
+        ArenaTree* pTree = createArenaTree(capacity);
+        for (int key = 0; key < 100; key++)
+            insertArena(&key, pTree);
+        bool ok = getArenaSize(pTree) == 100;
+        for (int key = 0; key < 100 && ok; key++)
+            ok = findArena(&key, pTree) != NULL;
+        destroyArenaTree(pTree);
+        if (!ok)
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]){
+    int n = argc > 1 ? atoi(argv[1]) : KEYS;
+    int* pKeys = (int*) malloc((size_t) n * sizeof(int));
+    if (n < 1 || pKeys == NULL)
+        OutofStorage();
+    benchFillRandom(pKeys, n);
+
+    if (!checkSmallCapacities()){
+        fprintf(stderr, "An ArenaTree created with a small capacity lost keys\n");
+        return EXIT_FAILURE;
+    }
+
+    long long pointerFound = 0, arenaFound = 0, sizedFound = 0;
+    long pointerKb = runPointerTree(pKeys, n, &pointerFound);
+    long sizedKb = runArenaTree(pKeys, n, n, &sizedFound);
+    long arenaKb = runArenaTree(pKeys, n, 0, &arenaFound);
+
+    printf("%-28s Tree %.1f, Arena sized %.1f, Arena %.1f bytes/key\n", "resident growth",
+           pointerKb * 1024.0 / n, sizedKb * 1024.0 / n, arenaKb * 1024.0 / n);
+    free(pKeys);
+    if (pointerFound != n || arenaFound != n || sizedFound != n){
+        fprintf(stderr, "The ArenaTree does not hold the same keys as the Tree\n");
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
@@ -0,0 +1,179 @@
+/**
+ * Compares searching and aggregating 10^7 ints in the LinkedList, one
+ * value per pointer hop, with the scan functions of the UnrolledList
+ * running the scalar, SSE2 and AVX2 kernels. Built with
+ * UNROLLED_NODE_SIZE=4096 it measures the contiguous block mode.
+ * Usage: bench_block_scan [values]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define LINKEDLIST_NO_MAIN
+#include "../SinglyLinkedList.c"
+#define UNROLLED_NO_MAIN
+#include "../UnrolledLinkedList.c"
+
+#define VALUES 10000000
+#define SCANS 5
+
+static const char* levelNames[] = {"scalar", "SSE2", "AVX2"};
+
+/* The results of one set of scans, compared between the containers. */
+typedef struct{
+    long long found;
+    long long count;
+    long long sum;
+    ListData min;
+    ListData max;
+} ScanResult;
+
+/**
+ * Runs every scan of the LinkedList, walking one Node per value.
+ *
+ * @param pList The list to scan.
+ * @param missing A value that is not in the list, so find walks all of it.
+ * @param common A value that occurs in the list.
+ * @param n The number of values.
+ * @return The results of the scans.
+*/
+static ScanResult scanLinkedList(LinkedList* pList, ListData missing, ListData common, int n){
+    ScanResult result = {0, 0, 0, 0, 0};
+    long long start = benchNow();
+    for (int s = 0; s < SCANS; s++){
+        int pos = 0;
+        ListNode* pNode = getFirstNode(pList);
+        while (pNode != NULL && *getData(pNode) != missing){
+            pNode = pNode->pNext;
+            pos++;
+        }
+        result.found += pNode == NULL ? -1 : pos;
+    }
+    benchReport("LinkedList find", (long long) SCANS * n, benchNow() - start);
+
+    start = benchNow();
+    for (int s = 0; s < SCANS; s++)
+        for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext)
+            result.count += *getData(pNode) == common;
+    benchReport("LinkedList count", (long long) SCANS * n, benchNow() - start);
+
+    start = benchNow();
+    for (int s = 0; s < SCANS; s++){
+        result.min = result.max = *getData(getFirstNode(pList));
+        for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext){
+            ListData data = *getData(pNode);
+            if (data < result.min)
+                result.min = data;
+            if (data > result.max)
+                result.max = data;
+        }
+    }
+    benchReport("LinkedList min+max", (long long) SCANS * n, benchNow() - start);
+
+    start = benchNow();
+    for (int s = 0; s < SCANS; s++)
+        for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext)
+            result.sum += *getData(pNode);
+    benchReport("LinkedList sum", (long long) SCANS * n, benchNow() - start);
+    return result;
+}
+
+/**
+ * Runs every scan of the UnrolledList with the kernels of one level.
+ *
+ * @param pList The list to scan.
+ * @param level The highest instruction set the kernels may use.
+ * @param missing A value that is not in the list, so find scans all of it.
+ * @param common A value that occurs in the list.
+ * @param n The number of values.
+ * @return The results of the scans.
+*/
+static ScanResult scanUnrolled(UnrolledList* pList, eScanLevel level, ListData missing,
+                               ListData common, int n){
+    ScanResult result = {0, 0, 0, 0, 0};
+    char name[64];
+    const char* pLevel = levelNames[selectUnrolledScan(level)];
+
+    long long start = benchNow();
+    for (int s = 0; s < SCANS; s++)
+        result.found += findUnrolled(pList, missing);
+    snprintf(name, sizeof(name), "Unrolled %s find", pLevel);
+    benchReport(name, (long long) SCANS * n, benchNow() - start);
+
+    start = benchNow();
+    for (int s = 0; s < SCANS; s++)
+        result.count += countUnrolled(pList, common);
+    snprintf(name, sizeof(name), "Unrolled %s count", pLevel);
+    benchReport(name, (long long) SCANS * n, benchNow() - start);
+
+    start = benchNow();
+    for (int s = 0; s < SCANS; s++){
+        minUnrolled(pList, &result.min);
+        maxUnrolled(pList, &result.max);
+    }
+    snprintf(name, sizeof(name), "Unrolled %s min+max", pLevel);
+    benchReport(name, (long long) SCANS * n, benchNow() - start);
+
+    start = benchNow();
+    for (int s = 0; s < SCANS; s++)
+        result.sum += sumUnrolled(pList);
+    snprintf(name, sizeof(name), "Unrolled %s sum", pLevel);
+    benchReport(name, (long long) SCANS * n, benchNow() - start);
+    return result;
+}
+
+int main(int argc, char* argv[]){
+    int n = argc > 1 ? atoi(argv[1]) : VALUES;
+    int* pValues = (int*) malloc((size_t) n * sizeof(int));
+    ListNode** pNodes = (ListNode**) malloc((size_t) n * sizeof(ListNode*));
+    if (n < 1 || pValues == NULL || pNodes == NULL)
+        OutofStorage();
+
+    /* Values in a small range, so count finds many matches, and a missing
+       value outside of it for find. */
+    benchFillRandom(pValues, n);
+    for (int i = 0; i < n; i++)
+        pValues[i] = pValues[i] % 1000 - 500;
+    ListData missing = 1000, common = pValues[n / 2];
+
+    /* A long lived list is scattered over the heap, so link the Nodes in
+       a shuffled allocation order. */
+    LinkedList* pList = createLinkedList();
+    for (int i = 0; i < n; i++)
+        pNodes[i] = createListNode(pList, pValues[i]);
+    for (int i = n - 1; i > 0; i--){
+        int j = (int) (((unsigned int) pValues[i] * 2654435761u) % (unsigned int) (i + 1));
+        ListNode* pTemp = pNodes[i];
+        pNodes[i] = pNodes[j];
+        pNodes[j] = pTemp;
+    }
+    for (int i = 0; i < n; i++)
+        insertNodetoBack(pList, pNodes[i]);
+
+    UnrolledList* pUnrolled = createUnrolledList();
+    for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext)
+        insertUnrolledBack(pUnrolled, *getData(pNode));
+
+    printf("UnrolledList Nodes of %d bytes, %d values each\n",
+           UNROLLED_NODE_SIZE, UNROLLED_CAPACITY);
+    ScanResult expected = scanLinkedList(pList, missing, common, n);
+    bool ok = true;
+    for (eScanLevel level = eScanScalar; level <= eScanAVX2; level++){
+        if (selectUnrolledScan(level) != level)
+            continue;
+        ScanResult result = scanUnrolled(pUnrolled, level, missing, common, n);
+        ok = ok && result.found == expected.found && result.count == expected.count
+             && result.sum == expected.sum && result.min == expected.min
+             && result.max == expected.max;
+    }
+
+    destroyLinkedList(pList);
+    destroyUnrolledList(pUnrolled);
+    free(pNodes);
+    free(pValues);
+    if (!ok){
+        fprintf(stderr, "The UnrolledList scans differ from the LinkedList scans\n");
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ * Compares lookup throughput of the pointer based Tree and the B+ Tree
+ * over multi-million key sets, doubling from one million keys up to the
+ * max size.
+ * Usage: bench_btree_lookup [max size]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define TREE_NO_MAIN
+#include "../Tree.c"
+/* BTree.c has the same function and type names as Tree.c, so they get a
+   B+ Tree prefix to share this file with it. */
+#define Tree BTree
+#define createTree createBTree
+#define getHeight getBTreeHeight
+#define getSize getBTreeSize
+#define insert insertBTree
+#define find findBTree
+#define destroyTree destroyBTree
+#define BTREE_NO_MAIN
+#include "../BTree.c"
+#undef Tree
+#undef createTree
+#undef getHeight
+#undef getSize
+#undef insert
+#undef find
+#undef destroyTree
+
+#define LOOKUPS 4000000
+#define MAX_SIZE 4000000
+
+int main(int argc, char* argv[]){
+    int maxSize = argc > 1 ? atoi(argv[1]) : MAX_SIZE;
+    int* probes = (int*) malloc(LOOKUPS * sizeof(int));
+    if (maxSize < 1 || probes == NULL)
+        return EXIT_FAILURE;
+
+    for (int n = maxSize < 1000000 ? maxSize : 1000000; n <= maxSize; n *= 2){
+        int* keys = (int*) malloc(n * sizeof(int));
+        benchFillRandom(keys, n);
+
+        Tree* pTree = createBalancedTree();
+        BTree* pBTree = createBTree();
+        for (int i = 0; i < n; i++){
+            insert(&keys[i], pTree);
+            insertBTree(&keys[i], pBTree);
+        }
+
+        /* Half of the probes hit, the other half are most likely misses. */
+        for (int i = 0; i < LOOKUPS; i++)
+            probes[i] = (i & 1) ? keys[(i * 7919LL) % n] : (int) (i * 2654435761u >> 1);
+
+        long long hits = 0;
+        long long start = benchNow();
+        for (int i = 0; i < LOOKUPS; i++){
+            Node* pNode = find(&probes[i], pTree);
+            hits += pNode != NULL ? pNode->count : 0;
+        }
+        printf("keys=%d\n", n);
+        benchReport("balanced Tree lookup", LOOKUPS, benchNow() - start);
+
+        long long bHits = 0;
+        start = benchNow();
+        for (int i = 0; i < LOOKUPS; i++)
+            bHits += findBTree(&probes[i], pBTree);
+        benchReport("B+ Tree lookup", LOOKUPS, benchNow() - start);
+
+        if (hits != bHits){
+            fprintf(stderr, "B+ Tree lookups disagree with the Tree\n");
+            return EXIT_FAILURE;
+        }
+
+        destroyTree(pTree);
+        destroyBTree(pBTree);
+        free(keys);
+    }
+
+    free(probes);
+    return 0;
+}
@@ -0,0 +1,288 @@
+/**
+ * Stress tests the ConcurrentTree and compares its throughput with a
+ * balanced Tree behind one global mutex, from 1 to 32 threads.
+ *
+ * The stress test runs writers that insert and erase random keys, and keep
+ * inserting ascending ones, while readers check that keys which are never
+ * erased are always found. The final count of every key must equal the
+ * inserts minus the successful erases of all writers, before and after
+ * rebuildConcurrentTree.
+ *
+ * The benchmark fills both Trees with random keys, then every thread runs
+ * a mix of 90% finds, 5% inserts and 5% erases. It runs again with the
+ * keys in ascending order, which a Tree that did not rotate would turn
+ * into a list; the time to fill the ConcurrentTree and its height are
+ * reported for both orders.
+ * Usage: bench_concurrent_tree [keys]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#include <pthread.h>
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define KEYS 1000000
+#define OPERATIONS 2000000
+#define MAX_THREADS 32
+#define STRESS_WRITERS 4
+#define STRESS_READERS 4
+#define STRESS_KEYS 4096
+#define STRESS_OPERATIONS 200000
+
+typedef struct{
+    int thread;
+    bool concurrent;
+    int operations;
+    int* pDeltas;
+    long long found;
+} Worker;
+
+ConcurrentTree* pShared;
+Tree* pLocked;
+pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+int* pKeys;
+int keyCount;
+atomic_bool writing;
+atomic_llong missing;
+
+/**
+ * Gets the next number of a per thread xorshift generator.
+ *
+ * @param pState The state of the generator, not zero.
+ * @return The next pseudo random number.
+*/
+static unsigned int nextRandom(unsigned int* pState){
+    unsigned int x = *pState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *pState = x;
+    return x;
+}
+
+/**
+ * Stress test writer. Inserts and erases keys below STRESS_KEYS, and
+ * inserts ascending keys from 2 * STRESS_KEYS up, which are never erased
+ * and keep the Tree rotating under the readers.
+ *
+ * @param pArg A pointer to the Worker of the thread.
+ * @return NULL.
+*/
+static void* stressWrite(void* pArg){
+    Worker* pWorker = (Worker*) pArg;
+    unsigned int state = 2463534242u + pWorker->thread;
+
+    for (int i = 0; i < STRESS_OPERATIONS; i++){
+        unsigned int r = nextRandom(&state);
+        int key = (int) (r % STRESS_KEYS);
+        if (r >> 30 == 0){
+            key = 2 * STRESS_KEYS + i * STRESS_WRITERS + pWorker->thread;
+            insertConcurrent(&key, pShared);
+        } else if (r >> 31 == 0){
+            insertConcurrent(&key, pShared);
+            pWorker->pDeltas[key]++;
+        } else if (eraseConcurrent(&key, pShared)){
+            pWorker->pDeltas[key]--;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Stress test reader. Looks up the keys that were inserted before the
+ * writers started and are never erased, until the writers are done.
+ *
+ * @param pArg A pointer to the Worker of the thread.
+ * @return NULL.
+*/
+static void* stressRead(void* pArg){
+    Worker* pWorker = (Worker*) pArg;
+    unsigned int state = 88172645u + pWorker->thread;
+
+    while (atomic_load(&writing)){
+        int key = STRESS_KEYS + 2 * (int) (nextRandom(&state) % (STRESS_KEYS / 2));
+        if (findConcurrent(&key, pShared) < 1)
+            atomic_fetch_add(&missing, 1);
+        pWorker->found++;
+    }
+    return NULL;
+}
+
+/**
+ * Checks the count of every key against the changes made by the writers.
+ *
+ * @param workers The writers.
+ * @return false if a count differs.
+*/
+static bool checkStressCounts(Worker* workers){
+    for (int key = 0; key < STRESS_KEYS; key++){
+        int expected = 0;
+        for (int t = 0; t < STRESS_WRITERS; t++)
+            expected += workers[t].pDeltas[key];
+        if (findConcurrent(&key, pShared) != expected){
+            fprintf(stderr, "key %d has count %d instead of %d\n", key,
+                    findConcurrent(&key, pShared), expected);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Runs the stress test.
+ *
+ * @return false if the ConcurrentTree lost, duplicated or hid a key.
+*/
+static bool stress(void){
+    pthread_t ids[STRESS_WRITERS + STRESS_READERS];
+    Worker workers[STRESS_WRITERS + STRESS_READERS] = {{0}};
+
+    pShared = createConcurrentTree();
+    for (int key = STRESS_KEYS; key < 2 * STRESS_KEYS; key += 2)
+        insertConcurrent(&key, pShared);
+    atomic_store(&writing, true);
+    atomic_store(&missing, 0);
+
+    for (int t = 0; t < STRESS_WRITERS + STRESS_READERS; t++){
+        workers[t].thread = t;
+        workers[t].pDeltas = (int*) calloc(STRESS_KEYS, sizeof(int));
+        if (workers[t].pDeltas == NULL)
+            OutofStorage();
+    }
+    for (int t = 0; t < STRESS_READERS; t++)
+        pthread_create(&ids[STRESS_WRITERS + t], NULL, stressRead, &workers[STRESS_WRITERS + t]);
+    for (int t = 0; t < STRESS_WRITERS; t++)
+        pthread_create(&ids[t], NULL, stressWrite, &workers[t]);
+    for (int t = 0; t < STRESS_WRITERS; t++)
+        pthread_join(ids[t], NULL);
+    atomic_store(&writing, false);
+    long long reads = 0;
+    for (int t = 0; t < STRESS_READERS; t++){
+        pthread_join(ids[STRESS_WRITERS + t], NULL);
+        reads += workers[STRESS_WRITERS + t].found;
+    }
+
+    bool ok = atomic_load(&missing) == 0 && checkStressCounts(workers);
+    int nodes = rebuildConcurrentTree(pShared);
+    ok = ok && checkStressCounts(workers);
+    printf("stress: %d writers x %d operations, %lld reads, %lld missed, %d Nodes kept\n",
+           STRESS_WRITERS, STRESS_OPERATIONS, reads, (long long) atomic_load(&missing), nodes);
+
+    for (int t = 0; t < STRESS_WRITERS + STRESS_READERS; t++)
+        free(workers[t].pDeltas);
+    destroyConcurrentTree(pShared);
+    return ok;
+}
+
+/**
+ * Benchmark thread body, running the mixed workload on one of the Trees.
+ *
+ * @param pArg A pointer to the Worker of the thread.
+ * @return NULL.
+*/
+static void* work(void* pArg){
+    Worker* pWorker = (Worker*) pArg;
+    unsigned int state = 2463534242u + 7919u * pWorker->thread;
+
+    for (int i = 0; i < pWorker->operations; i++){
+        unsigned int r = nextRandom(&state);
+        int key = pKeys[r % keyCount];
+        unsigned int op = r >> 25 & 127;
+
+        if (pWorker->concurrent){
+            if (op < 6)
+                insertConcurrent(&key, pShared);
+            else if (op < 12)
+                eraseConcurrent(&key, pShared);
+            else
+                pWorker->found += findConcurrent(&key, pShared) > 0;
+        } else {
+            pthread_mutex_lock(&lock);
+            if (op < 6)
+                insert(&key, pLocked);
+            else if (op < 12)
+                erase(&key, pLocked);
+            else
+                pWorker->found += find(&key, pLocked) != NULL;
+            pthread_mutex_unlock(&lock);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Runs the mixed workload on freshly filled Trees and reports the
+ * throughput.
+ *
+ * @param threads The number of threads.
+ * @param concurrent Whether to use the ConcurrentTree.
+ * @param pOrder The order of the keys, for the report.
+*/
+static void run(int threads, bool concurrent, const char* pOrder){
+    pthread_t ids[MAX_THREADS];
+    Worker workers[MAX_THREADS] = {{0}};
+    char name[64];
+
+    if (concurrent){
+        long long start = benchNow();
+        pShared = createConcurrentTree();
+        for (int i = 0; i < keyCount; i++)
+            insertConcurrent(&pKeys[i], pShared);
+        if (threads == 1){
+            snprintf(name, sizeof(name), "concurrent fill %s, height %d", pOrder,
+                     atomic_load(&pShared->root)->height);
+            benchReport(name, keyCount, benchNow() - start);
+        }
+    } else {
+        pLocked = buildTreeFromArray(pKeys, keyCount);
+    }
+
+    long long start = benchNow();
+    for (int t = 0; t < threads; t++){
+        workers[t].thread = t;
+        workers[t].concurrent = concurrent;
+        workers[t].operations = OPERATIONS / threads;
+        pthread_create(&ids[t], NULL, work, &workers[t]);
+    }
+    for (int t = 0; t < threads; t++)
+        pthread_join(ids[t], NULL);
+    long long ns = benchNow() - start;
+
+    snprintf(name, sizeof(name), "%s %s %2d threads", concurrent ? "concurrent" : "mutex",
+             pOrder, threads);
+    benchReport(name, (long long) OPERATIONS / threads * threads, ns);
+
+    if (concurrent)
+        destroyConcurrentTree(pShared);
+    else
+        destroyTree(pLocked);
+}
+
+int main(int argc, char* argv[]){
+    if (!stress()){
+        fprintf(stderr, "The ConcurrentTree failed the stress test\n");
+        return EXIT_FAILURE;
+    }
+
+    keyCount = argc > 1 ? atoi(argv[1]) : KEYS;
+    pKeys = (int*) malloc((size_t) keyCount * sizeof(int));
+    if (keyCount < 1 || pKeys == NULL)
+        OutofStorage();
+    benchFillRandom(pKeys, keyCount);
+
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2){
+        run(threads, false, "random");
+        run(threads, true, "random");
+    }
+
+    for (int i = 0; i < keyCount; i++)
+        pKeys[i] = i;
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2){
+        run(threads, false, "sorted");
+        run(threads, true, "sorted");
+    }
+    free(pKeys);
+    return 0;
+}
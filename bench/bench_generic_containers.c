@@ -0,0 +1,135 @@
+/**
+ * Instantiates the containers of GenericContainers.h for a 32 byte record
+ * and measures them against the same containers holding pointers to
+ * records, which is what a void* payload costs: a second allocation per
+ * element and a pointer chase per comparison. Both trees get the same
+ * random ids, so the finds must agree, and the list must pop its records
+ * back in order.
+ * Usage: bench_generic_containers [records]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#include "../GenericContainers.h"
+
+#define RECORDS 1000000
+
+typedef struct{
+    long long id;
+    double x;
+    double y;
+    int flags;
+} Record;
+
+static int compareRecord(const Record* a, const Record* b){
+    return (a->id > b->id) - (a->id < b->id);
+}
+
+static int compareBoxed(Record* const* a, Record* const* b){
+    return compareRecord(*a, *b);
+}
+
+typedef Record* BoxedRecord;
+
+DEFINE_LIST(RecordList, Record)
+DEFINE_TREE(RecordTree, Record, compareRecord)
+DEFINE_LIST(BoxedList, BoxedRecord)
+DEFINE_TREE(BoxedTree, BoxedRecord, compareBoxed)
+
+int main(int argc, char* argv[]){
+    int n = argc > 1 ? atoi(argv[1]) : RECORDS;
+    int* pIds = (int*) malloc((size_t) n * sizeof(int));
+    if (n < 1 || pIds == NULL)
+        return EXIT_FAILURE;
+    benchFillRandom(pIds, n);
+    printf("sizeof(Record) = %zu\n", sizeof(Record));
+
+    RecordList* pList = RecordListCreate();
+    long long start = benchNow();
+    for (int i = 0; i < n; i++){
+        Record record = {i, i * 0.5, i * 2.0, 0};
+        RecordListPushBack(pList, record);
+    }
+    benchReport("inline list push", n, benchNow() - start);
+
+    BoxedList* pBoxedList = BoxedListCreate();
+    start = benchNow();
+    for (int i = 0; i < n; i++){
+        Record* pRecord = (Record*) genericAlloc(sizeof(Record));
+        pRecord->id = i;
+        pRecord->x = i * 0.5;
+        pRecord->y = i * 2.0;
+        BoxedListPushBack(pBoxedList, pRecord);
+    }
+    benchReport("boxed list push", n, benchNow() - start);
+
+    bool ok = RecordListSize(pList) == n && BoxedListSize(pBoxedList) == n;
+    Record record;
+    start = benchNow();
+    for (int i = 0; RecordListPopFront(pList, &record); i++)
+        ok = ok && record.id == i;
+    benchReport("inline list pop", n, benchNow() - start);
+
+    BoxedRecord pBoxed;
+    start = benchNow();
+    for (int i = 0; BoxedListPopFront(pBoxedList, &pBoxed); i++){
+        ok = ok && pBoxed->id == i;
+        trackedFree(pBoxed);
+    }
+    benchReport("boxed list pop", n, benchNow() - start);
+    RecordListDestroy(pList);
+    BoxedListDestroy(pBoxedList);
+
+    RecordTree* pTree = RecordTreeCreate();
+    start = benchNow();
+    for (int i = 0; i < n; i++){
+        Record key = {pIds[i], 0.0, 0.0, 0};
+        RecordTreeInsert(pTree, &key);
+    }
+    benchReport("inline tree insert", n, benchNow() - start);
+
+    BoxedTree* pBoxedTree = BoxedTreeCreate();
+    BoxedRecord* pRecords = (BoxedRecord*) malloc((size_t) n * sizeof(BoxedRecord));
+    if (pRecords == NULL)
+        return EXIT_FAILURE;
+    start = benchNow();
+    for (int i = 0; i < n; i++){
+        pRecords[i] = (Record*) genericAlloc(sizeof(Record));
+        pRecords[i]->id = pIds[i];
+        BoxedTreeInsert(pBoxedTree, &pRecords[i]);
+    }
+    benchReport("boxed tree insert", n, benchNow() - start);
+
+    long long hits = 0, boxedHits = 0;
+    start = benchNow();
+    for (int i = 0; i < n; i++){
+        Record key = {pIds[i] + i % 2, 0.0, 0.0, 0};
+        hits += RecordTreeFind(pTree, &key) != NULL;
+    }
+    benchReport("inline tree find", n, benchNow() - start);
+
+    Record boxedKey = {0, 0.0, 0.0, 0};
+    BoxedRecord pKey = &boxedKey;
+    start = benchNow();
+    for (int i = 0; i < n; i++){
+        boxedKey.id = pIds[i] + i % 2;
+        boxedHits += BoxedTreeFind(pBoxedTree, &pKey) != NULL;
+    }
+    benchReport("boxed tree find", n, benchNow() - start);
+
+    ok = ok && hits == boxedHits && RecordTreeSize(pTree) == BoxedTreeSize(pBoxedTree);
+    printf("tree height %d, %d distinct ids\n", RecordTreeHeight(pTree), RecordTreeSize(pTree));
+
+    RecordTreeDestroy(pTree);
+    BoxedTreeDestroy(pBoxedTree);
+    for (int i = 0; i < n; i++)
+        trackedFree(pRecords[i]);
+    free(pRecords);
+    free(pIds);
+    if (!ok){
+        fprintf(stderr, "The inline and boxed containers do not agree\n");
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
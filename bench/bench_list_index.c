@@ -0,0 +1,98 @@
+/**
+ * Measures membership checks and removals by value on a SinglyLinkedList
+ * of 10^6 values, with and without the value index. Without it every
+ * call walks the list, so only BENCH_LINEAR_SAMPLE calls are timed. The
+ * values repeat, as in a dedup stage, so both hits and misses are timed.
+ * A last run indexes only 100 distinct values that differ in their high
+ * bits, each repeated many times.
+ * Usage: bench_list_index [values]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#include "../SinglyLinkedList.h"
+
+#define VALUES 1000000
+
+int main(int argc, char* argv[]){
+    int n = argc > 1 ? atoi(argv[1]) : VALUES;
+    int* values = (int*) malloc((size_t) n * sizeof(int));
+    if (n < 1 || values == NULL)
+        return EXIT_FAILURE;
+    benchFillRandom(values, n);
+    for (int i = 0; i < n; i++)
+        values[i] %= n;
+
+    int sample = n < BENCH_LINEAR_SAMPLE ? n : BENCH_LINEAR_SAMPLE;
+    SinglyLinkedList plain = {0};
+    SinglyLinkedList indexed = {0};
+    createValueIndex(&indexed);
+
+    long long start = benchNow();
+    for (int i = 0; i < n; i++)
+        addTailNode(&plain, &values[i]);
+    benchReport("addTailNode", n, benchNow() - start);
+
+    start = benchNow();
+    for (int i = 0; i < n; i++)
+        addTailNode(&indexed, &values[i]);
+    benchReport("addTailNode indexed", n, benchNow() - start);
+
+    /* A key queried at an even i was added, one at an odd i only if another
+       random value hit it. */
+    long long plainHits = 0, indexedHits = 0;
+    start = benchNow();
+    for (int i = 0; i < sample; i++){
+        int key = values[i] + i % 2;
+        plainHits += containsValue(&plain, &key);
+    }
+    benchReport("containsValue", sample, benchNow() - start);
+
+    start = benchNow();
+    for (int i = 0; i < n; i++){
+        int key = values[i] + i % 2;
+        bool found = containsValue(&indexed, &key);
+        if (i < sample)
+            indexedHits += found;
+    }
+    benchReport("containsValue indexed", n, benchNow() - start);
+
+    start = benchNow();
+    for (int i = 0; i < sample; i++)
+        removeValue(&plain, &values[n - 1 - i]);
+    benchReport("removeValue", sample, benchNow() - start);
+
+    start = benchNow();
+    long long removed = 0;
+    for (int i = 0; i < n; i++)
+        removed += removeValue(&indexed, &values[n - 1 - i]);
+    benchReport("removeValue indexed", n, benchNow() - start);
+
+    bool ok = plainHits == indexedHits && removed == n && getNodeCount(&indexed) == 0
+              && indexed.head == NULL && getNodeCount(&plain) == n - sample;
+    destroyList(&plain);
+    destroyList(&indexed);
+
+    for (int i = 0; i < n; i++)
+        values[i] = (i % 100) << 16;
+    createValueIndex(&indexed);
+    start = benchNow();
+    for (int i = 0; i < n; i++)
+        addTailNode(&indexed, &values[i]);
+    benchReport("addTailNode indexed, 100 values", n, benchNow() - start);
+
+    start = benchNow();
+    removed = 0;
+    for (int i = 0; i < n; i++)
+        removed += removeValue(&indexed, &values[i]);
+    benchReport("removeValue indexed, 100 values", n, benchNow() - start);
+    ok = ok && removed == n && indexed.head == NULL;
+    destroyList(&indexed);
+    free(values);
+    if (!ok){
+        fprintf(stderr, "The indexed list does not match the plain list\n");
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
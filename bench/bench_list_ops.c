@@ -0,0 +1,133 @@
+/**
+ * Micro-benchmark harness covering the LinkedList operations. Every
+ * measurement is printed as one CSV row, so results from two runs can be
+ * compared to catch performance regressions before a release. Built with
+ * BENCH_DOUBLY_LINKED defined, it measures DoublyLinkedList.c instead.
+ * 
+ * Usage: bench_list_ops [max size]
+ * 
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#ifdef BENCH_DOUBLY_LINKED
+#define DOUBLYLINKEDLIST_NO_MAIN
+#include "../DoublyLinkedList.c"
+#define LIST_NAME "DoublyLinkedList"
+#else
+#define LINKEDLIST_NO_MAIN
+#include "../SinglyLinkedList.c"
+#define LIST_NAME "LinkedList"
+#endif
+
+#define MIN_SIZE 100
+#define MAX_SIZE 10000000
+
+/* Results are stored here so the timed loops can't be optimised out. */
+static volatile long long benchSink;
+
+/**
+ * Times the LinkedList operations at one size.
+ * 
+ * @param pKeys The values to store.
+ * @param n The number of values.
+ * @param dist The distribution used for the values and getNode positions.
+*/
+static void benchLinkedList(int* pKeys, int n, eDistribution dist){
+    LinkedList* pList = createLinkedList();
+    long long start = benchNow();
+    for (int i = 0; i < n; i++)
+        insertNodetoFront(pList, createListNode(pList, pKeys[i]));
+    benchReportCsv(LIST_NAME, "insert-front", dist, n, n, benchNow() - start);
+    destroyLinkedList(pList);
+
+    pList = createLinkedList();
+    start = benchNow();
+    for (int i = 0; i < n; i++)
+        insertNodetoBack(pList, createListNode(pList, pKeys[i]));
+    benchReportCsv(LIST_NAME, "insert-back", dist, n, n, benchNow() - start);
+
+    int samples = n < BENCH_LINEAR_SAMPLE ? n : BENCH_LINEAR_SAMPLE;
+    long long sum = 0;
+    start = benchNow();
+    for (int i = 0; i < samples; i++){
+        int pos = dist == eSorted ? (int) ((long long) i * n / samples)
+                                  : (pKeys[i] & 0x7fffffff) % n;
+        sum += *getData(getNode(pList, pos));
+    }
+    benchReportCsv(LIST_NAME, "getNode", dist, n, samples, benchNow() - start);
+
+#ifndef BENCH_DOUBLY_LINKED
+    enableListIndex(pList);
+    start = benchNow();
+    for (int i = 0; i < n; i++){
+        int pos = dist == eSorted ? i : (pKeys[i] & 0x7fffffff) % n;
+        sum += *getData(getNode(pList, pos));
+    }
+    benchReportCsv(LIST_NAME, "getNode-indexed", dist, n, n, benchNow() - start);
+
+    start = benchNow();
+    for (int i = 0; i < samples; i++){
+        int pos = dist == eSorted ? getSize(pList) / 2 : (pKeys[i] & 0x7fffffff) % getSize(pList);
+        deleteNode(removeNodeAt(pList, pos));
+        insertNodeAt(pList, pos, createListNode(pList, pKeys[i]));
+    }
+    benchReportCsv(LIST_NAME, "remove+insertNodeAt-indexed", dist, n, 2LL * samples,
+                   benchNow() - start);
+
+    /* Pushes and pops keep the index in sync instead of forcing a rebuild. */
+    start = benchNow();
+    for (int i = 0; i < samples; i++){
+        sum += *getData(getNode(pList, (pKeys[i] & 0x7fffffff) % getSize(pList)));
+        insertNodetoBack(pList, createListNode(pList, pKeys[i]));
+    }
+    for (int i = 0; i < samples; i++)
+        deleteNode(removeNodefromBack(pList));
+    benchReportCsv(LIST_NAME, "getNode+push/pop-back-indexed", dist, n, 2LL * samples,
+                   benchNow() - start);
+    disableListIndex(pList);
+
+    ListCursor cursor;
+    start = benchNow();
+    for (seekListCursor(&cursor, pList, 0); getCursorNode(&cursor) != NULL;
+         advanceListCursor(&cursor))
+        sum += *getData(getCursorNode(&cursor));
+    benchReportCsv(LIST_NAME, "cursor-scan", dist, n, n, benchNow() - start);
+#endif
+
+    start = benchNow();
+    for (int i = 0; i < samples; i++)
+        deleteNode(removeNodefromBack(pList));
+    benchReportCsv(LIST_NAME, "remove-back", dist, n, samples, benchNow() - start);
+
+    int remaining = getSize(pList);
+    start = benchNow();
+    while (!isEmpty(pList)){
+        ListNode* pNode = removeNodefromFront(pList);
+        sum += *getData(pNode);
+        deleteNode(pNode);
+    }
+    benchReportCsv(LIST_NAME, "remove-front", dist, n, remaining, benchNow() - start);
+
+    destroyLinkedList(pList);
+    benchSink = sum;
+}
+
+int main(int argc, char* argv[]){
+    int maxSize = argc > 1 ? atoi(argv[1]) : MAX_SIZE;
+    int* pKeys = (int*) malloc((size_t) maxSize * sizeof(int));
+    if (pKeys == NULL)
+        OutofStorage();
+
+    benchCsvHeader();
+    for (int n = MIN_SIZE; n <= maxSize; n *= 10){
+        for (eDistribution dist = eSorted; dist <= eRandom; dist++){
+            benchFillKeys(pKeys, n, dist);
+            benchLinkedList(pKeys, n, dist);
+        }
+    }
+
+    free(pKeys);
+    return 0;
+}
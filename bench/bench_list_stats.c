@@ -0,0 +1,70 @@
+/**
+ * Shows what the operation statistics report for a LinkedList that is
+ * used by position. Without the position index every getNode walks from
+ * the front, and removeNodefromBack walks the whole list; with the index
+ * the walks of getNode, insertNodeAt and removeNodeAt stay short.
+ * Usage: bench_list_stats [nodes]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#ifndef COLLECT_STATS
+#define COLLECT_STATS
+#endif
+#include "bench.h"
+#define LINKEDLIST_NO_MAIN
+#include "../SinglyLinkedList.c"
+
+#define NODES 100000
+
+/**
+ * Looks up, removes and inserts Nodes at random positions, then removes
+ * a few Nodes from the back, and prints the statistics of the run.
+ *
+ * @param name The name of the run.
+ * @param pList The list to use.
+ * @param pKeys Random keys used as positions.
+ * @return The average walk of getNode.
+*/
+static double run(const char* name, LinkedList* pList, const int* pKeys){
+    resetStats();
+    long long sum = 0;
+    for (int i = 0; i < BENCH_LINEAR_SAMPLE; i++){
+        int pos = (pKeys[i] & 0x7fffffff) % getSize(pList);
+        sum += *getData(getNode(pList, pos));
+        ListNode* pNode = removeNodeAt(pList, pos);
+        insertNodeAt(pList, pos, pNode);
+    }
+    for (int i = 0; i < 10; i++)
+        insertNodetoBack(pList, removeNodefromBack(pList));
+
+    printf("== %s (sum %lld)\n", name, sum);
+    dumpStats(stdout);
+    OperationStats stats = getStats(eStatsListGetNode);
+    return (double) stats.steps / stats.calls;
+}
+
+int main(int argc, char* argv[]){
+    int n = argc > 1 ? atoi(argv[1]) : NODES;
+    int* pKeys = (int*) malloc((size_t) (n > BENCH_LINEAR_SAMPLE ? n : BENCH_LINEAR_SAMPLE)
+                               * sizeof(int));
+    if (pKeys == NULL)
+        OutofStorage();
+    benchFillRandom(pKeys, n > BENCH_LINEAR_SAMPLE ? n : BENCH_LINEAR_SAMPLE);
+
+    LinkedList* pList = createLinkedList();
+    for (int i = 0; i < n; i++)
+        insertNodetoBack(pList, createListNode(pList, i));
+
+    double plainWalk = run("plain list", pList, pKeys);
+    enableListIndex(pList);
+    double indexedWalk = run("indexed list", pList, pKeys);
+
+    destroyLinkedList(pList);
+    free(pKeys);
+    if (n >= 1000 && indexedWalk >= plainWalk){
+        fprintf(stderr, "The index did not shorten the getNode walks\n");
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * Reports how much the LinkedList allocates per operation and how high
+ * its memory peaks, with allocation tracking compiled in. Every scenario
+ * checks that it freed everything it allocated, and the program fails
+ * if one leaked.
+ * Usage: bench_memory_list [nodes]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#ifndef TRACK_ALLOCATIONS
+#define TRACK_ALLOCATIONS
+#endif
+#include "bench.h"
+#define LINKEDLIST_NO_MAIN
+#include "../SinglyLinkedList.c"
+
+#define NODES 1000000
+
+static bool leaked = false;
+
+/**
+ * Starts a scenario by taking a snapshot of the counters and lowering
+ * the peak, so the peak printed for it is its own.
+ *
+ * @return The snapshot.
+*/
+static AllocStats startScenario(void){
+    resetAllocPeak();
+    return getAllocStats();
+}
+
+/**
+ * Ends a scenario and records whether it leaked.
+ *
+ * @param pScenario The name of the scenario.
+ * @param pBefore The snapshot taken by startScenario.
+*/
+static void endScenario(const char* pScenario, const AllocStats* pBefore){
+    if (!checkNoLeaks(stderr, pScenario, pBefore))
+        leaked = true;
+}
+
+/**
+ * Fills a list from the back with n Nodes.
+ *
+ * @param pList The list to fill.
+ * @param pKeys The data to store.
+ * @param n The number of Nodes.
+*/
+static void fillList(LinkedList* pList, const int* pKeys, int n){
+    for (int i = 0; i < n; i++)
+        insertNodetoBack(pList, createListNode(pList, pKeys[i]));
+}
+
+int main(int argc, char* argv[]){
+    int n = argc > 1 ? atoi(argv[1]) : NODES;
+    int* pKeys = (int*) malloc((size_t) n * sizeof(int));
+    if (pKeys == NULL)
+        OutofStorage();
+    benchFillRandom(pKeys, n);
+
+    AllocStats before = startScenario();
+    LinkedList* pList = createLinkedList();
+    AllocStats step = getAllocStats();
+    fillList(pList, pKeys, n);
+    printAllocRate(stdout, "insertNodetoBack", &step, n);
+    step = getAllocStats();
+    while (!isEmpty(pList))
+        deleteNode(removeNodefromFront(pList));
+    printAllocRate(stdout, "removeNodefromFront", &step, n);
+    destroyLinkedList(pList);
+    endScenario("heap Nodes", &before);
+
+    before = startScenario();
+    pList = createPooledLinkedList(NULL);
+    step = getAllocStats();
+    fillList(pList, pKeys, n);
+    printAllocRate(stdout, "pooled insertNodetoBack", &step, n);
+    step = getAllocStats();
+    while (!isEmpty(pList))
+        deleteNode(removeNodefromFront(pList));
+    printAllocRate(stdout, "pooled removeNodefromFront", &step, n);
+    destroyLinkedList(pList);
+    endScenario("pooled Nodes", &before);
+
+    before = startScenario();
+    pList = createLinkedList();
+    fillList(pList, pKeys, n);
+    step = getAllocStats();
+    enableListIndex(pList);
+    printAllocRate(stdout, "enableListIndex", &step, n);
+    int samples = n < BENCH_LINEAR_SAMPLE ? n : BENCH_LINEAR_SAMPLE;
+    step = getAllocStats();
+    for (int i = 0; i < samples; i++){
+        int pos = (pKeys[i] & 0x7fffffff) % n;
+        deleteNode(removeNodeAt(pList, pos));
+        insertNodeAt(pList, pos, createListNode(pList, pKeys[i]));
+    }
+    printAllocRate(stdout, "remove+insertNodeAt-indexed", &step, 2LL * samples);
+    destroyLinkedList(pList);
+    endScenario("indexed list", &before);
+
+    before = startScenario();
+    pList = createLinkedList();
+    fillList(pList, pKeys, n);
+    step = getAllocStats();
+    sortList(pList, eAscending);
+    printAllocRate(stdout, "sortList", &step, n);
+    step = getAllocStats();
+    LinkedList* pTail = splitAt(pList, n / 2);
+    concatenateList(pList, pTail);
+    printAllocRate(stdout, "splitAt+concatenateList", &step, 2);
+    destroyLinkedList(pTail);
+    ListThreadPool* pPool = createListThreadPool(4);
+    step = getAllocStats();
+    parallelSortList(pList, pPool, compareData, eDescending);
+    printAllocRate(stdout, "parallelSortList", &step, n);
+    destroyListThreadPool(pPool);
+    destroyLinkedList(pList);
+    endScenario("sorting", &before);
+
+    printAllocStats(stdout, "after all scenarios");
+    free(pKeys);
+    return leaked ? EXIT_FAILURE : 0;
+}
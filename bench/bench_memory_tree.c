@@ -0,0 +1,109 @@
+/**
+ * Reports how much the Tree allocates per operation and how high its
+ * memory peaks, with allocation tracking compiled in. Every scenario ends
+ * with destroyTree and checks that it freed everything it allocated, and
+ * the program fails if one leaked.
+ * Usage: bench_memory_tree [keys]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#ifndef TRACK_ALLOCATIONS
+#define TRACK_ALLOCATIONS
+#endif
+#include "bench.h"
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define KEYS 1000000
+
+static bool leaked = false;
+
+/**
+ * Starts a scenario by taking a snapshot of the counters and lowering
+ * the peak, so the peak printed for it is its own.
+ *
+ * @return The snapshot.
+*/
+static AllocStats startScenario(void){
+    resetAllocPeak();
+    return getAllocStats();
+}
+
+/**
+ * Ends a scenario and records whether it leaked.
+ *
+ * @param pScenario The name of the scenario.
+ * @param pBefore The snapshot taken by startScenario.
+*/
+static void endScenario(const char* pScenario, const AllocStats* pBefore){
+    if (!checkNoLeaks(stderr, pScenario, pBefore))
+        leaked = true;
+}
+
+static int compareInts(const void* pA, const void* pB){
+    int a = *(const int*) pA, b = *(const int*) pB;
+    return (a > b) - (a < b);
+}
+
+int main(int argc, char* argv[]){
+    int n = argc > 1 ? atoi(argv[1]) : KEYS;
+    int* pKeys = (int*) malloc((size_t) n * sizeof(int));
+    if (pKeys == NULL)
+        OutofStorage();
+    benchFillRandom(pKeys, n);
+
+    AllocStats before = startScenario();
+    Tree* pTree = createBalancedTree();
+    AllocStats step = getAllocStats();
+    for (int i = 0; i < n; i++)
+        insert(&pKeys[i], pTree);
+    printAllocRate(stdout, "insert", &step, n);
+    step = getAllocStats();
+    long long found = 0;
+    for (int i = 0; i < n; i++)
+        found += find(&pKeys[i], pTree) != NULL;
+    printAllocRate(stdout, "find", &step, n);
+    step = getAllocStats();
+    for (int i = 0; i < n / 2; i++)
+        erase(&pKeys[i], pTree);
+    printAllocRate(stdout, "erase", &step, n / 2);
+    step = getAllocStats();
+    TreeIterator* pIter = createTreeIterator(pTree);
+    while (hasNext(pIter))
+        nextNode(pIter);
+    deleteTreeIterator(pIter);
+    printAllocRate(stdout, "iterator scan", &step, 1);
+    destroyTree(pTree);
+    endScenario("insert and erase", &before);
+
+    before = startScenario();
+    step = getAllocStats();
+    pTree = buildTreeFromArray(pKeys, n);
+    printAllocRate(stdout, "buildTreeFromArray", &step, n);
+    step = getAllocStats();
+    for (int i = 0; i < n / 2; i++)
+        erase(&pKeys[i], pTree);
+    for (int i = 0; i < n / 2; i++)
+        insert(&pKeys[i], pTree);
+    printAllocRate(stdout, "erase+insert on built Tree", &step, 2LL * (n / 2));
+    destroyTree(pTree);
+    endScenario("bulk built Tree", &before);
+
+    before = startScenario();
+    qsort(pKeys, n, sizeof(int), compareInts);
+    pTree = createBalancedTree();
+    step = getAllocStats();
+    insertSortedBatch(pKeys, n, pTree);
+    printAllocRate(stdout, "insertSortedBatch", &step, n);
+    destroyTree(pTree);
+    endScenario("sorted batch", &before);
+
+    printAllocStats(stdout, "after all scenarios");
+    free(pKeys);
+    if (found != n){
+        fprintf(stderr, "find missed keys\n");
+        return EXIT_FAILURE;
+    }
+    return leaked ? EXIT_FAILURE : 0;
+}
@@ -0,0 +1,99 @@
+/**
+ * Compares the cold start of a LinkedList: rebuilding it from a file of
+ * ints against mapping a file written by saveLinkedList. Both sides sum
+ * every data once they are ready, and the page cache of the files is
+ * dropped before each run.
+ * Usage: bench_mmap_list [max nodes]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define LINKEDLIST_NO_MAIN
+#include "../SinglyLinkedList.c"
+
+#define MAX_NODES 10000000
+
+static const char* pKeysPath = "bench_list_keys.bin";
+static const char* pMapPath = "bench_list.map";
+
+/**
+ * Reads the keys file and appends every key to a new LinkedList, as a
+ * program without a saved list does at startup.
+ * 
+ * @return A pointer to the rebuilt LinkedList.
+*/
+static LinkedList* rebuildList(void){
+    int n = 0;
+    int* pKeys = benchReadInts(pKeysPath, &n);
+    if (pKeys == NULL){
+        fprintf(stderr, "Could not read %s\n", pKeysPath);
+        exit(EXIT_FAILURE);
+    }
+    LinkedList* pList = createPooledLinkedList(NULL);
+    for (int i = 0; i < n; i++)
+        insertNodetoBack(pList, createListNode(pList, pKeys[i]));
+    free(pKeys);
+    return pList;
+}
+
+int main(int argc, char** argv){
+    int maxNodes = argc > 1 ? atoi(argv[1]) : MAX_NODES;
+    int* pKeys = (int*) malloc(maxNodes * sizeof(int));
+    if (pKeys == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        return EXIT_FAILURE;
+    }
+
+    for (int n = 100000 < maxNodes ? 100000 : maxNodes; n <= maxNodes; n *= 10){
+        benchFillRandom(pKeys, n);
+        LinkedList* pSaved = createPooledLinkedList(NULL);
+        for (int i = 0; i < n; i++)
+            insertNodetoBack(pSaved, createListNode(pSaved, pKeys[i]));
+        if (benchWriteInts(pKeysPath, pKeys, n) != 0 || !saveLinkedList(pSaved, pMapPath)){
+            fprintf(stderr, "Could not write the input files\n");
+            return EXIT_FAILURE;
+        }
+        destroyLinkedList(pSaved);
+        printf("%d nodes\n", n);
+
+        benchDropCache(pKeysPath);
+        long long start = benchNow();
+        LinkedList* pList = rebuildList();
+        long long ready = benchNow() - start;
+        long long rebuiltSum = 0;
+        for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext)
+            rebuiltSum += *getData(pNode);
+        long long total = benchNow() - start;
+        benchReport("rebuild: read + insert", n, ready);
+        benchReport("rebuild + scan", n, total);
+
+        benchDropCache(pMapPath);
+        MappedList mapped;
+        start = benchNow();
+        if (!openMappedList(&mapped, pMapPath)){
+            fprintf(stderr, "Could not map %s\n", pMapPath);
+            return EXIT_FAILURE;
+        }
+        ready = benchNow() - start;
+        long long mappedSum = 0;
+        for (int i = 0; i < getMappedListSize(&mapped); i++)
+            mappedSum += *getMappedListAt(&mapped, i);
+        total = benchNow() - start;
+        benchReport("mmap: openMappedList", n, ready);
+        benchReport("mmap + scan", n, total);
+
+        if (getMappedListSize(&mapped) != n || mappedSum != rebuiltSum){
+            fprintf(stderr, "The mapped list differs from the rebuilt one\n");
+            return EXIT_FAILURE;
+        }
+        closeMappedList(&mapped);
+        destroyLinkedList(pList);
+    }
+
+    remove(pKeysPath);
+    remove(pMapPath);
+    free(pKeys);
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * Compares the cold start of a Tree: rebuilding it from a file of ints
+ * against mapping a file written by saveTree. Both sides answer the same
+ * lookups, and the page cache of the files is dropped before each run.
+ * Usage: bench_mmap_tree [max keys]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define MAX_KEYS 1000000
+#define LOOKUPS 1000
+
+static const char* pKeysPath = "bench_tree_keys.bin";
+static const char* pMapPath = "bench_tree.map";
+
+/**
+ * Reads the keys file and inserts every key into a new Tree, as a
+ * program without a saved Tree does at startup.
+ * 
+ * @return A pointer to the rebuilt Tree.
+*/
+static Tree* rebuildTree(void){
+    int n = 0;
+    int* pKeys = benchReadInts(pKeysPath, &n);
+    if (pKeys == NULL){
+        fprintf(stderr, "Could not read %s\n", pKeysPath);
+        exit(EXIT_FAILURE);
+    }
+    Tree* pTree = createBalancedTree();
+    for (int i = 0; i < n; i++)
+        insert(&pKeys[i], pTree);
+    free(pKeys);
+    return pTree;
+}
+
+int main(int argc, char** argv){
+    int maxKeys = argc > 1 ? atoi(argv[1]) : MAX_KEYS;
+    int* pKeys = (int*) malloc(maxKeys * sizeof(int));
+    if (pKeys == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        return EXIT_FAILURE;
+    }
+
+    for (int n = 100000 < maxKeys ? 100000 : maxKeys; n <= maxKeys; n *= 10){
+        benchFillRandom(pKeys, n);
+        Tree* pSaved = buildTreeFromArray(pKeys, n);
+        if (benchWriteInts(pKeysPath, pKeys, n) != 0 || !saveTree(pSaved, pMapPath)){
+            fprintf(stderr, "Could not write the input files\n");
+            return EXIT_FAILURE;
+        }
+        destroyTree(pSaved);
+        printf("%d keys\n", n);
+
+        /* Every other lookup misses. */
+        int queries[LOOKUPS];
+        for (int i = 0; i < LOOKUPS; i++)
+            queries[i] = i % 2 == 0 ? pKeys[(long long) i * n / LOOKUPS] : -1 - i;
+
+        benchDropCache(pKeysPath);
+        long long start = benchNow();
+        Tree* pTree = rebuildTree();
+        long long ready = benchNow() - start;
+        long long rebuiltHits = 0;
+        for (int i = 0; i < LOOKUPS; i++){
+            Node* pNode = find(&queries[i], pTree);
+            rebuiltHits += pNode != NULL ? pNode->count : 0;
+        }
+        long long total = benchNow() - start;
+        benchReport("rebuild: read + insert", n, ready);
+        benchReport("rebuild + lookups", LOOKUPS, total);
+
+        benchDropCache(pMapPath);
+        MappedTree mapped;
+        start = benchNow();
+        if (!openMappedTree(&mapped, pMapPath)){
+            fprintf(stderr, "Could not map %s\n", pMapPath);
+            return EXIT_FAILURE;
+        }
+        ready = benchNow() - start;
+        long long mappedHits = 0;
+        for (int i = 0; i < LOOKUPS; i++){
+            const MappedTreeNode* pNode = findMappedTree(&queries[i], &mapped);
+            mappedHits += pNode != NULL ? pNode->count : 0;
+        }
+        total = benchNow() - start;
+        benchReport("mmap: openMappedTree", n, ready);
+        benchReport("mmap + lookups", LOOKUPS, total);
+
+        if (getMappedTreeSize(&mapped) > n || mappedHits != rebuiltHits){
+            fprintf(stderr, "The mapped Tree differs from the rebuilt one\n");
+            return EXIT_FAILURE;
+        }
+        closeMappedTree(&mapped);
+        destroyTree(pTree);
+    }
+
+    remove(pKeysPath);
+    remove(pMapPath);
+    free(pKeys);
+    return 0;
+}
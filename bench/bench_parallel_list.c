@@ -0,0 +1,120 @@
+/**
+ * Measures the speedup of the parallel sort, map and reductions over the
+ * LinkedList as the number of threads grows from 1 to 32.
+ * Usage: bench_parallel_list [nodes]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define LINKEDLIST_NO_MAIN
+#include "../SinglyLinkedList.c"
+
+#define DEFAULT_NODES 10000000
+#define MAX_THREADS 32
+
+static void scaleData(ListData* pData, void* pContext){
+    *pData = *pData / 2 + *(int*) pContext;
+}
+
+/**
+ * Checks that the LinkedList holds n data in ascending order.
+ * 
+ * @param pList The list to check.
+ * @param n The expected number of Nodes.
+ * @return true if the list is sorted.
+*/
+static bool isSorted(LinkedList* pList, int n){
+    ListNode* pPrev = NULL;
+    int count = 0;
+    for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext){
+        if (pPrev != NULL && *getData(pPrev) > *getData(pNode))
+            return false;
+        pPrev = pNode;
+        count++;
+    }
+    return count == n && getLastNode(pList) == pPrev;
+}
+
+/**
+ * Fills the list with the same pseudo random data for every run.
+ * 
+ * @param pList The empty list to fill.
+ * @param pKeys The data to insert.
+ * @param n The number of Nodes.
+*/
+static void fillList(LinkedList* pList, int* pKeys, int n){
+    for (int i = 0; i < n; i++)
+        insertNodetoBack(pList, createListNode(pList, pKeys[i]));
+}
+
+int main(int argc, char** argv){
+    int n = argc > 1 ? atoi(argv[1]) : DEFAULT_NODES;
+    int* pKeys = (int*) malloc(n * sizeof(int));
+    if (pKeys == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        return EXIT_FAILURE;
+    }
+    benchFillRandom(pKeys, n);
+
+    long long expected = 0;
+    for (int i = 0; i < n; i++)
+        expected += pKeys[i];
+
+    LinkedList* pList = createPooledLinkedList(NULL);
+    fillList(pList, pKeys, n);
+    long long start = benchNow();
+    sortList(pList, eAscending);
+    long long sequential = benchNow() - start;
+    benchReport("sortList (sequential)", n, sequential);
+    destroyLinkedList(pList);
+
+    long long baseSort = 0;
+    long long baseSum = 0;
+    long long baseMap = 0;
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2){
+        ListThreadPool* pPool = createListThreadPool(threads);
+        char name[64];
+        printf("--- %d thread(s)\n", threads);
+
+        pList = createPooledLinkedList(NULL);
+        fillList(pList, pKeys, n);
+
+        start = benchNow();
+        long long sum = parallelSumList(pList, pPool);
+        long long ns = benchNow() - start;
+        if (threads == 1)
+            baseSum = ns;
+        snprintf(name, sizeof(name), "sum (x%.2f)", (double) baseSum / ns);
+        benchReport(name, n, ns);
+
+        int offset = 1;
+        start = benchNow();
+        parallelMapList(pList, pPool, scaleData, &offset);
+        ns = benchNow() - start;
+        if (threads == 1)
+            baseMap = ns;
+        snprintf(name, sizeof(name), "map (x%.2f)", (double) baseMap / ns);
+        benchReport(name, n, ns);
+
+        start = benchNow();
+        parallelSortList(pList, pPool, compareData, eAscending);
+        ns = benchNow() - start;
+        if (threads == 1)
+            baseSort = ns;
+        snprintf(name, sizeof(name), "sort (x%.2f)", (double) baseSort / ns);
+        benchReport(name, n, ns);
+
+        if (sum != expected || !isSorted(pList, n)){
+            fprintf(stderr, "parallel result differs from the sequential one\n");
+            return EXIT_FAILURE;
+        }
+
+        destroyLinkedList(pList);
+        destroyListThreadPool(pPool);
+    }
+
+    free(pKeys);
+    return 0;
+}
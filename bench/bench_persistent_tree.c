@@ -0,0 +1,177 @@
+/**
+ * Compares taking a point in time view of a Tree by deep copy with a
+ * snapshot of the PersistentTree, and measures what snapshots cost the
+ * inserts that follow them. A reporter thread then reads published
+ * snapshots while the writer keeps inserting, and checks every snapshot
+ * it reads is consistent. Allocation tracking is compiled in, so the
+ * bytes copied per insert are counted and leaks fail the run.
+ * Usage: bench_persistent_tree [keys]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#ifndef TRACK_ALLOCATIONS
+#define TRACK_ALLOCATIONS
+#endif
+#include "bench.h"
+#include <pthread.h>
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define KEYS 1000000
+#define SNAPSHOTS 20
+#define PUBLISH_EVERY 1000
+
+PersistentTree* pPublished;
+pthread_mutex_t publishLock = PTHREAD_MUTEX_INITIALIZER;
+atomic_bool writing;
+long long reports;
+long long inconsistent;
+
+/**
+ * Copies a subtree of the Tree Node by Node.
+ *
+ * @param pNode The root Node of the subtree, or NULL.
+ * @return The root Node of the copy.
+*/
+static Node* copySubtree(Node* pNode){
+    if (pNode == NULL)
+        return NULL;
+    Node* pCopy = createNode(pNode->data);
+    pCopy->count = pNode->count;
+    pCopy->height = pNode->height;
+    pCopy->weight = pNode->weight;
+    pCopy->leftChild = copySubtree(pNode->leftChild);
+    pCopy->rightChild = copySubtree(pNode->rightChild);
+    return pCopy;
+}
+
+/* Sums a snapshot and checks that its keys are in order. */
+typedef struct{
+    long long total;
+    int nodes;
+    long long last;
+    bool ordered;
+} SnapshotReport;
+
+static void reportNode(const PersistentNode* pNode, void* pContext){
+    SnapshotReport* pReport = (SnapshotReport*) pContext;
+    pReport->ordered = pReport->ordered && pNode->data > pReport->last;
+    pReport->last = pNode->data;
+    pReport->total += pNode->count;
+    pReport->nodes++;
+}
+
+/**
+ * Reporter thread. Reads the latest published snapshot until the writer
+ * is done, checking each one against its own size and total.
+ *
+ * @param pArg Unused.
+ * @return NULL.
+*/
+static void* report(void* pArg){
+    while (atomic_load(&writing)){
+        pthread_mutex_lock(&publishLock);
+        PersistentTree* pSnapshot = snapshotPersistentTree(pPublished);
+        pthread_mutex_unlock(&publishLock);
+
+        SnapshotReport result = {0, 0, LLONG_MIN, true};
+        visitPersistent(pSnapshot, reportNode, &result);
+        if (!result.ordered || result.total != getPersistentTotal(pSnapshot)
+            || result.nodes != getPersistentSize(pSnapshot))
+            inconsistent++;
+        reports++;
+
+        pthread_mutex_lock(&publishLock);
+        releasePersistentTree(pSnapshot);
+        pthread_mutex_unlock(&publishLock);
+    }
+    return pArg;
+}
+
+int main(int argc, char* argv[]){
+    int n = argc > 1 ? atoi(argv[1]) : KEYS;
+    int* pKeys = (int*) malloc(2 * (size_t) n * sizeof(int));
+    if (n < 1 || pKeys == NULL)
+        OutofStorage();
+    benchFillRandom(pKeys, 2 * n);
+    AllocStats before = getAllocStats();
+
+    Tree* pTree = createBalancedTree();
+    PersistentTree* pVersion = createPersistentTree();
+    for (int i = 0; i < n; i++){
+        insert(&pKeys[i], pTree);
+        insertPersistent(&pKeys[i], pVersion);
+    }
+
+    long long start = benchNow();
+    for (int s = 0; s < SNAPSHOTS; s++){
+        Tree* pCopy = createBalancedTree();
+        pCopy->root = copySubtree(pTree->root);
+        pCopy->height = pTree->height;
+        destroyTree(pCopy);
+    }
+    benchReport("deep copy + destroy", SNAPSHOTS, benchNow() - start);
+
+    start = benchNow();
+    for (int s = 0; s < SNAPSHOTS; s++)
+        releasePersistentTree(snapshotPersistentTree(pVersion));
+    benchReport("snapshot + release", SNAPSHOTS, benchNow() - start);
+
+    /* Without a snapshot the Nodes belong to the version alone and are
+       changed in place; right after one, every insert copies its path. */
+    int batch = n / 10;
+    AllocStats step = getAllocStats();
+    start = benchNow();
+    for (int i = 0; i < batch; i++)
+        insertPersistent(&pKeys[n + i], pVersion);
+    benchReport("insert, no snapshot", batch, benchNow() - start);
+    printAllocRate(stdout, "insert, no snapshot", &step, batch);
+
+    step = getAllocStats();
+    start = benchNow();
+    for (int i = 0; i < batch; i++){
+        PersistentTree* pSnapshot = snapshotPersistentTree(pVersion);
+        insertPersistent(&pKeys[n + batch + i], pVersion);
+        releasePersistentTree(pSnapshot);
+    }
+    benchReport("snapshot+insert+release", batch, benchNow() - start);
+    printAllocRate(stdout, "snapshot+insert+release", &step, batch);
+    printf("%-28s %d\n", "height", getPersistentHeight(pVersion));
+
+    /* The writer publishes a snapshot every PUBLISH_EVERY inserts while
+       the reporter walks the latest one. */
+    pthread_t reporter;
+    pPublished = snapshotPersistentTree(pVersion);
+    atomic_store(&writing, true);
+    pthread_create(&reporter, NULL, report, NULL);
+    start = benchNow();
+    for (int i = 0; i < n; i++){
+        insertPersistent(&pKeys[i], pVersion);
+        if (i % PUBLISH_EVERY == 0){
+            PersistentTree* pSnapshot = snapshotPersistentTree(pVersion);
+            pthread_mutex_lock(&publishLock);
+            PersistentTree* pOld = pPublished;
+            pPublished = pSnapshot;
+            releasePersistentTree(pOld);
+            pthread_mutex_unlock(&publishLock);
+        }
+    }
+    benchReport("insert with reporter", n, benchNow() - start);
+    atomic_store(&writing, false);
+    pthread_join(reporter, NULL);
+    printf("%-28s %lld snapshots read, %lld inconsistent\n", "reporter", reports, inconsistent);
+
+    bool ok = inconsistent == 0 && getPersistentTotal(pVersion) == 2LL * n + 2 * batch
+              && getPersistentTotal(pPublished) <= getPersistentTotal(pVersion);
+    releasePersistentTree(pPublished);
+    releasePersistentTree(pVersion);
+    destroyTree(pTree);
+    ok = checkNoLeaks(stderr, "persistent Tree", &before) && ok;
+    free(pKeys);
+    if (!ok){
+        fprintf(stderr, "A snapshot was inconsistent or the versions lost keys\n");
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+/**
+ * Compares insert/remove throughput of heap allocated and pooled Nodes
+ * in the LinkedList.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define LINKEDLIST_NO_MAIN
+#include "../SinglyLinkedList.c"
+
+#define ROUNDS 5
+
+/**
+ * Fills the list from the back and drains it from the front a few times,
+ * returning every Node to its allocator.
+ * 
+ * @param pList The list to exercise.
+ * @param n The number of Nodes inserted per round.
+ * @return The sum of the removed data, so the work can't be optimised out.
+*/
+static long long churn(LinkedList* pList, int n){
+    long long sum = 0;
+    for (int r = 0; r < ROUNDS; r++){
+        for (int i = 0; i < n; i++)
+            insertNodetoBack(pList, createListNode(pList, i));
+        while (!isEmpty(pList)){
+            ListNode* pNode = removeNodefromFront(pList);
+            sum += *getData(pNode);
+            deleteNode(pNode);
+        }
+    }
+    return sum;
+}
+
+int main(){
+    for (int n = 1000; n <= 1000000; n *= 10){
+        LinkedList* pHeap = createLinkedList();
+        long long start = benchNow();
+        long long heapSum = churn(pHeap, n);
+        benchReport("malloc insert+remove", 2LL * ROUNDS * n, benchNow() - start);
+        destroyLinkedList(pHeap);
+
+        LinkedList* pPooled = createPooledLinkedList(NULL);
+        start = benchNow();
+        long long poolSum = churn(pPooled, n);
+        benchReport("pool insert+remove", 2LL * ROUNDS * n, benchNow() - start);
+
+        if (heapSum != poolSum){
+            fprintf(stderr, "pooled list returned different data\n");
+            return EXIT_FAILURE;
+        }
+
+        for (int i = 0; i < n; i++)
+            insertNodetoBack(pPooled, createListNode(pPooled, i));
+        start = benchNow();
+        destroyLinkedList(pPooled);
+        benchReport("pool destroyLinkedList", n, benchNow() - start);
+
+        pHeap = createLinkedList();
+        for (int i = 0; i < n; i++)
+            insertNodetoBack(pHeap, createListNode(pHeap, i));
+        start = benchNow();
+        destroyLinkedList(pHeap);
+        benchReport("malloc destroyLinkedList", n, benchNow() - start);
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * Compares producer/consumer throughput of the lock-free ConcurrentQueue
+ * with a LinkedList guarded by a mutex, from 1 to 32 threads.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#include <pthread.h>
+#define LINKEDLIST_NO_MAIN
+#include "../SinglyLinkedList.c"
+#define CONCURRENTQUEUE_NO_MAIN
+#include "../ConcurrentQueue.c"
+
+#define ITEMS 400000
+#define MAX_THREADS 32
+
+typedef enum{
+    eProducer = 0,
+    eConsumer,
+    eBoth
+} eRole;
+
+typedef struct{
+    eRole role;
+    int items;
+    bool lockFree;
+} Worker;
+
+ConcurrentQueue* pQueue;
+LinkedList* pLocked;
+pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+atomic_int remaining;
+atomic_llong consumedSum;
+
+/**
+ * Adds one item to the queue under test.
+ * 
+ * @param pWorker The calling worker.
+ * @param thread The queue thread number of the worker.
+ * @param data The item to add.
+*/
+static void put(Worker* pWorker, int thread, ListData data){
+    if (pWorker->lockFree){
+        enqueue(pQueue, thread, data);
+    } else {
+        ListNode* pNode = createListNode(pLocked, data);
+        pthread_mutex_lock(&lock);
+        insertNodetoBack(pLocked, pNode);
+        pthread_mutex_unlock(&lock);
+    }
+}
+
+/**
+ * Takes one item from the queue under test.
+ * 
+ * @param pWorker The calling worker.
+ * @param thread The queue thread number of the worker.
+ * @param pData Set to the item taken.
+ * @return false if the queue was empty.
+*/
+static bool take(Worker* pWorker, int thread, ListData* pData){
+    if (pWorker->lockFree)
+        return dequeue(pQueue, thread, pData);
+
+    pthread_mutex_lock(&lock);
+    ListNode* pNode = removeNodefromFront(pLocked);
+    pthread_mutex_unlock(&lock);
+    if (pNode == NULL)
+        return false;
+    *pData = *getData(pNode);
+    deleteNode(pNode);
+    return true;
+}
+
+/**
+ * Thread body. Producers add their items, consumers take items until all
+ * produced items have been consumed, and a single thread does both.
+ * 
+ * @param pArg A pointer to the Worker of the thread.
+ * @return NULL.
+*/
+static void* work(void* pArg){
+    Worker* pWorker = (Worker*) pArg;
+    int thread = pWorker->lockFree ? attachQueueThread(pQueue) : 0;
+    ListData data;
+    long long sum = 0;
+
+    if (pWorker->role != eConsumer)
+        for (int i = 1; i <= pWorker->items; i++)
+            put(pWorker, thread, i);
+
+    if (pWorker->role != eProducer){
+        while (atomic_load(&remaining) > 0){
+            if (take(pWorker, thread, &data)){
+                sum += data;
+                atomic_fetch_sub(&remaining, 1);
+            }
+        }
+    }
+    atomic_fetch_add(&consumedSum, sum);
+    return NULL;
+}
+
+/**
+ * Runs one configuration and reports its throughput.
+ * 
+ * @param threads The total number of threads.
+ * @param lockFree Whether to use the ConcurrentQueue.
+*/
+static void run(int threads, bool lockFree){
+    pthread_t ids[MAX_THREADS];
+    Worker workers[MAX_THREADS];
+    int producers = threads == 1 ? 1 : threads / 2;
+    long long expected = 0;
+
+    pQueue = createConcurrentQueue(threads);
+    pLocked = createLinkedList();
+    int total = 0;
+
+    for (int t = 0; t < threads; t++){
+        workers[t].lockFree = lockFree;
+        workers[t].role = threads == 1 ? eBoth : (t < producers ? eProducer : eConsumer);
+        workers[t].items = workers[t].role == eConsumer ? 0 : ITEMS / producers;
+        total += workers[t].items;
+        expected += (long long) workers[t].items * (workers[t].items + 1) / 2;
+    }
+    atomic_store(&remaining, total);
+    atomic_store(&consumedSum, 0);
+
+    long long start = benchNow();
+    for (int t = 0; t < threads; t++)
+        pthread_create(&ids[t], NULL, work, &workers[t]);
+    for (int t = 0; t < threads; t++)
+        pthread_join(ids[t], NULL);
+    long long ns = benchNow() - start;
+
+    char name[64];
+    snprintf(name, sizeof(name), "%s %2d threads", lockFree ? "lock-free" : "mutex", threads);
+    benchReport(name, 2LL * total, ns);
+
+    if (atomic_load(&consumedSum) != expected){
+        fprintf(stderr, "%s lost or duplicated items\n", name);
+        exit(EXIT_FAILURE);
+    }
+    destroyConcurrentQueue(pQueue);
+    destroyLinkedList(pLocked);
+}
+
+int main(){
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2){
+        run(threads, false);
+        run(threads, true);
+    }
+    return 0;
+}
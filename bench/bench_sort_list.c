@@ -0,0 +1,98 @@
+/**
+ * Compares sortList, which merge sorts the LinkedList in place, against
+ * copying the data to an array, sorting it with qsort and copying it back.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define LINKEDLIST_NO_MAIN
+#include "../SinglyLinkedList.c"
+
+#define MAX_NODES 10000000
+
+static int compareInts(const void* pA, const void* pB){
+    int a = *(const int*) pA;
+    int b = *(const int*) pB;
+    return (a > b) - (a < b);
+}
+
+/**
+ * Sorts the data of the LinkedList through a temporary array.
+ * 
+ * @param pList The list to sort.
+ * @param pBuffer An array with room for every data in the list.
+*/
+static void sortThroughArray(LinkedList* pList, int* pBuffer){
+    int n = 0;
+    for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext)
+        pBuffer[n++] = *getData(pNode);
+    qsort(pBuffer, n, sizeof(int), compareInts);
+    n = 0;
+    for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext)
+        *getData(pNode) = pBuffer[n++];
+}
+
+/**
+ * Checks that the LinkedList holds n data in ascending order and that the
+ * last Node is the tail.
+ * 
+ * @param pList The list to check.
+ * @param n The expected number of Nodes.
+ * @return true if the list is sorted.
+*/
+static bool isSorted(LinkedList* pList, int n){
+    ListNode* pPrev = NULL;
+    int count = 0;
+    for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext){
+        if (pPrev != NULL && *getData(pPrev) > *getData(pNode))
+            return false;
+        pPrev = pNode;
+        count++;
+    }
+    return count == n && getLastNode(pList) == pPrev;
+}
+
+int main(){
+    int* pKeys = (int*) malloc(MAX_NODES * sizeof(int));
+    int* pBuffer = (int*) malloc(MAX_NODES * sizeof(int));
+    if (pKeys == NULL || pBuffer == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        return EXIT_FAILURE;
+    }
+    benchFillRandom(pKeys, MAX_NODES);
+
+    for (int n = 1000000; n <= MAX_NODES; n *= 10){
+        LinkedList* pMerge = createPooledLinkedList(NULL);
+        LinkedList* pArray = createPooledLinkedList(NULL);
+        for (int i = 0; i < n; i++){
+            insertNodetoBack(pMerge, createListNode(pMerge, pKeys[i]));
+            insertNodetoBack(pArray, createListNode(pArray, pKeys[i]));
+        }
+
+        long long start = benchNow();
+        sortList(pMerge, eAscending);
+        benchReport("sortList merge sort", n, benchNow() - start);
+
+        start = benchNow();
+        sortThroughArray(pArray, pBuffer);
+        benchReport("copy + qsort + copy back", n, benchNow() - start);
+
+        if (!isSorted(pMerge, n) || !isSorted(pArray, n)){
+            fprintf(stderr, "list is not sorted\n");
+            return EXIT_FAILURE;
+        }
+
+        start = benchNow();
+        sortList(pMerge, eDescending);
+        benchReport("sortList descending", n, benchNow() - start);
+
+        destroyLinkedList(pMerge);
+        destroyLinkedList(pArray);
+    }
+
+    free(pKeys);
+    free(pBuffer);
+    return 0;
+}
@@ -0,0 +1,42 @@
+/**
+ * Measures appending to the SinglyLinkedList one node at a time and in
+ * batches. Both should scale linearly with the number of elements.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#include "../SinglyLinkedList.h"
+
+int main(){
+    int* values = (int*) malloc(10000000 * sizeof(int));
+    benchFillRandom(values, 10000000);
+
+    for (int n = 1000; n <= 10000000; n *= 10){
+        SinglyLinkedList list = {0};
+
+        long long start = benchNow();
+        for (int i = 0; i < n; i++)
+            addTailNode(&list, &values[i]);
+        benchReport("addTailNode", n, benchNow() - start);
+
+        if (getNodeCount(&list) != n || *(list.tail->data) != values[n - 1]){
+            fprintf(stderr, "addTailNode produced a broken list\n");
+            return EXIT_FAILURE;
+        }
+        destroyList(&list);
+
+        start = benchNow();
+        appendArray(&list, values, n);
+        benchReport("appendArray", n, benchNow() - start);
+
+        if (getNodeCount(&list) != n || *(list.tail->data) != values[n - 1]){
+            fprintf(stderr, "appendArray produced a broken list\n");
+            return EXIT_FAILURE;
+        }
+        destroyList(&list);
+    }
+
+    free(values);
+    return 0;
+}
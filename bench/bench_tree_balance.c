@@ -0,0 +1,57 @@
+/**
+ * Compares building the plain and the balanced Tree from sorted, reverse
+ * sorted and random keys.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define KEYS 1000000
+/* The plain Tree is quadratic on ordered input, so it gets fewer keys. */
+#define PLAIN_ORDERED_KEYS 20000
+
+/**
+ * Builds a Tree from the keys and reports the time taken and its height,
+ * then destroys it.
+ * 
+ * @param name The name of the measured case.
+ * @param pTree An empty Tree to insert into, destroyed on return.
+ * @param pKeys The keys to insert.
+ * @param n The number of keys.
+*/
+static void build(const char* name, Tree* pTree, int* pKeys, int n){
+    long long start = benchNow();
+    for (int i = 0; i < n; i++)
+        insert(&pKeys[i], pTree);
+    benchReport(name, n, benchNow() - start);
+    printf("%-28s height=%d\n", "", getHeight(pTree));
+    destroyTree(pTree);
+}
+
+int main(){
+    int* sorted = (int*) malloc(KEYS * sizeof(int));
+    int* reverse = (int*) malloc(KEYS * sizeof(int));
+    int* random = (int*) malloc(KEYS * sizeof(int));
+
+    for (int i = 0; i < KEYS; i++){
+        sorted[i] = i;
+        reverse[i] = KEYS - i;
+    }
+    benchFillRandom(random, KEYS);
+
+    build("balanced sorted", createBalancedTree(), sorted, KEYS);
+    build("balanced reverse", createBalancedTree(), reverse, KEYS);
+    build("balanced random", createBalancedTree(), random, KEYS);
+
+    build("plain sorted", createTree(), sorted, PLAIN_ORDERED_KEYS);
+    build("plain reverse", createTree(), reverse, PLAIN_ORDERED_KEYS);
+    build("plain random", createTree(), random, KEYS);
+
+    free(sorted);
+    free(reverse);
+    free(random);
+    return 0;
+}
@@ -0,0 +1,58 @@
+/**
+ * Compares loading a balanced Tree with one insert per key against
+ * buildTreeFromArray, for sorted and random keys.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define MAX_KEYS 10000000
+
+/**
+ * Counts the Nodes of the Tree and the copies of data they hold.
+ * 
+ * @param pTree The Tree to count.
+ * @return The sum of the counts of all Nodes.
+*/
+static long long countKeys(Tree* pTree){
+    long long total = 0;
+    TreeIterator* pIter = createTreeIterator(pTree);
+    while (hasNext(pIter))
+        total += nextNode(pIter)->count;
+    deleteTreeIterator(pIter);
+    return total;
+}
+
+int main(){
+    int* keys = (int*) malloc(MAX_KEYS * sizeof(int));
+
+    for (int n = 1000000; n <= MAX_KEYS; n *= 10){
+        for (eDistribution dist = eSorted; dist <= eRandom; dist++){
+            benchFillKeys(keys, n, dist);
+            printf("%s keys\n", dist == eSorted ? "sorted" : "random");
+
+            Tree* pInserted = createBalancedTree();
+            long long start = benchNow();
+            for (int i = 0; i < n; i++)
+                insert(&keys[i], pInserted);
+            benchReport("insert per key", n, benchNow() - start);
+
+            start = benchNow();
+            Tree* pBuilt = buildTreeFromArray(keys, n);
+            benchReport("buildTreeFromArray", n, benchNow() - start);
+
+            if (countKeys(pBuilt) != n || getHeight(pBuilt) > getHeight(pInserted)){
+                fprintf(stderr, "buildTreeFromArray built a wrong Tree\n");
+                return EXIT_FAILURE;
+            }
+            destroyTree(pInserted);
+            destroyTree(pBuilt);
+        }
+    }
+
+    free(keys);
+    return 0;
+}
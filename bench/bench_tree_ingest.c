@@ -0,0 +1,151 @@
+/**
+ * Measures the ingestion of a text file of integers into a Tree: reading
+ * one key at a time with fscanf and calling insert, against
+ * loadTreeFromFd with its batched finger insertion. Throughput is
+ * reported in MB/s and keys/s.
+ * Usage: bench_tree_ingest [keys | file | -]
+ * With a number, a file of that many random keys is generated (default
+ * 10^7). With a path, that file is loaded instead, so multi-GB inputs
+ * from a producer can be measured. With -, only loadTreeFromFd runs, on
+ * the stdin, so a pipe can be measured.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define DEFAULT_KEYS 10000000
+
+static const char* pGeneratedPath = "bench_tree_ingest.txt";
+
+/**
+ * Prints the throughput of one ingestion run.
+ * 
+ * @param name The name of the measured loader.
+ * @param bytes The number of bytes read.
+ * @param keys The number of keys loaded.
+ * @param ns The total time taken in nanoseconds.
+*/
+static void reportThroughput(const char* name, long long bytes, long long keys, long long ns){
+    double seconds = ns / 1e9;
+    printf("%-28s %10.2f ms %8.1f MB/s %12.0f keys/s\n", name, ns / 1e6,
+           bytes / 1e6 / seconds, keys / seconds);
+}
+
+/**
+ * Checks that two Trees hold the same keys with the same counts.
+ * 
+ * @param pA The first Tree.
+ * @param pB The second Tree.
+ * @return true if the Trees hold the same keys.
+*/
+static bool sameKeys(Tree* pA, Tree* pB){
+    TreeIterator* pIterA = createTreeIterator(pA);
+    TreeIterator* pIterB = createTreeIterator(pB);
+    bool same = true;
+    while (same && hasNext(pIterA)){
+        Node* pNodeA = nextNode(pIterA);
+        Node* pNodeB = hasNext(pIterB) ? nextNode(pIterB) : NULL;
+        same = pNodeB != NULL && *(pNodeA->data) == *(pNodeB->data)
+               && pNodeA->count == pNodeB->count;
+    }
+    same = same && !hasNext(pIterB);
+    deleteTreeIterator(pIterA);
+    deleteTreeIterator(pIterB);
+    return same;
+}
+
+/**
+ * Writes the given number of pseudo random keys as text, one per line.
+ * 
+ * @param pPath The path of the file.
+ * @param n The number of keys.
+ * @return false if the file could not be written.
+*/
+static bool generateKeys(const char* pPath, int n){
+    FILE* pFile = fopen(pPath, "w");
+    if (pFile == NULL)
+        return false;
+    int* pKeys = (int*) malloc(n * sizeof(int));
+    if (pKeys == NULL){
+        fclose(pFile);
+        return false;
+    }
+    benchFillRandom(pKeys, n);
+    for (int i = 0; i < n; i++)
+        fprintf(pFile, "%d\n", pKeys[i] % 100000000);
+    free(pKeys);
+    return fclose(pFile) == 0;
+}
+
+int main(int argc, char** argv){
+    const char* pPath = pGeneratedPath;
+    bool generated = true;
+    long long keys = 0;
+
+    if (argc > 1 && strcmp(argv[1], "-") == 0){
+        Tree* pTree = createBalancedTree();
+        TreeLoadStats stats;
+        long long start = benchNow();
+        bool ok = loadTreeFromFd(pTree, STDIN_FILENO, &stats);
+        reportThroughput("loadTreeFromFd (stdin)", stats.bytes, stats.keys, benchNow() - start);
+        if (stats.rejected > 0)
+            fprintf(stderr, "Rejected %lld integers out of range\n", stats.rejected);
+        destroyTree(pTree);
+        return ok ? 0 : EXIT_FAILURE;
+    }
+    if (argc > 1 && atoi(argv[1]) <= 0){
+        pPath = argv[1];
+        generated = false;
+    } else if (!generateKeys(pPath, argc > 1 ? atoi(argv[1]) : DEFAULT_KEYS)){
+        fprintf(stderr, "Could not write %s\n", pPath);
+        return EXIT_FAILURE;
+    }
+
+    benchDropCache(pPath);
+    FILE* pFile = fopen(pPath, "r");
+    if (pFile == NULL){
+        fprintf(stderr, "Could not read %s\n", pPath);
+        return EXIT_FAILURE;
+    }
+    Tree* pInserted = createBalancedTree();
+    long long start = benchNow();
+    TreeData key;
+    while (fscanf(pFile, "%d", &key) == 1){
+        insert(&key, pInserted);
+        keys++;
+    }
+    long long ns = benchNow() - start;
+    long long bytes = ftell(pFile);
+    fclose(pFile);
+    reportThroughput("fscanf + insert per key", bytes, keys, ns);
+
+    benchDropCache(pPath);
+    int fd = open(pPath, O_RDONLY);
+    Tree* pLoaded = createBalancedTree();
+    TreeLoadStats stats;
+    start = benchNow();
+    bool ok = fd >= 0 && loadTreeFromFd(pLoaded, fd, &stats);
+    ns = benchNow() - start;
+    if (fd >= 0)
+        close(fd);
+    if (!ok){
+        fprintf(stderr, fd >= 0 && stats.rejected > 0 ? "Integers out of range in %s\n"
+                                                      : "Could not read %s\n", pPath);
+        return EXIT_FAILURE;
+    }
+    reportThroughput("loadTreeFromFd", stats.bytes, stats.keys, ns);
+
+    if (stats.keys != keys || !sameKeys(pInserted, pLoaded)){
+        fprintf(stderr, "loadTreeFromFd built a different Tree\n");
+        return EXIT_FAILURE;
+    }
+
+    destroyTree(pInserted);
+    destroyTree(pLoaded);
+    if (generated)
+        remove(pPath);
+    return 0;
+}
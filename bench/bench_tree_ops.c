@@ -0,0 +1,67 @@
+/**
+ * Micro-benchmark harness covering the Tree operations. Every measurement
+ * is printed as one CSV row, in the same format as bench_list_ops.
+ * 
+ * Usage: bench_tree_ops [max size]
+ * 
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define MIN_SIZE 100
+#define MAX_SIZE 10000000
+/* The plain Tree is quadratic on sorted keys, so larger sizes are skipped. */
+#define PLAIN_SORTED_MAX 10000
+
+/**
+ * Times Tree insertion and lookup at one size.
+ * 
+ * @param pTree An empty Tree to insert into.
+ * @param name The name reported for the Tree.
+ * @param pKeys The keys to insert and then look up.
+ * @param n The number of keys.
+ * @param dist The distribution of the keys.
+*/
+static void benchTree(Tree* pTree, const char* name, int* pKeys, int n,
+                      eDistribution dist){
+    long long start = benchNow();
+    for (int i = 0; i < n; i++)
+        insert(&pKeys[i], pTree);
+    benchReportCsv(name, "insert", dist, n, n, benchNow() - start);
+
+    long long hits = 0;
+    start = benchNow();
+    for (int i = 0; i < n; i++)
+        hits += find(&pKeys[i], pTree) != NULL;
+    benchReportCsv(name, "lookup", dist, n, n, benchNow() - start);
+
+    if (hits != n){
+        fprintf(stderr, "%s lost keys during the benchmark\n", name);
+        exit(EXIT_FAILURE);
+    }
+    destroyTree(pTree);
+}
+
+int main(int argc, char* argv[]){
+    int maxSize = argc > 1 ? atoi(argv[1]) : MAX_SIZE;
+    int* pKeys = (int*) malloc((size_t) maxSize * sizeof(int));
+    if (pKeys == NULL)
+        OutofStorage();
+
+    benchCsvHeader();
+    for (int n = MIN_SIZE; n <= maxSize; n *= 10){
+        for (eDistribution dist = eSorted; dist <= eRandom; dist++){
+            benchFillKeys(pKeys, n, dist);
+            benchTree(createBalancedTree(), "BalancedTree", pKeys, n, dist);
+            if (dist == eRandom || n <= PLAIN_SORTED_MAX)
+                benchTree(createTree(), "Tree", pKeys, n, dist);
+        }
+    }
+
+    free(pKeys);
+    return 0;
+}
@@ -0,0 +1,114 @@
+/**
+ * Uses the Tree as a histogram of latency samples, with one Node per
+ * distinct latency and its count as the frequency, and compares reading
+ * quantiles with percentile against walking the Tree in order until the
+ * running count reaches the quantile. The samples are inserted one by
+ * one, so the cost of keeping the weights up to date shows in insert.
+ * Usage: bench_tree_percentile [samples]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define SAMPLES 1000000
+#define QUERIES 1000
+
+static const double quantiles[] = {50.0, 90.0, 99.0, 99.9};
+
+/**
+ * Finds a quantile by walking the Tree in order.
+ *
+ * @param p The percentile, from 0 to 100.
+ * @param pTree The Tree.
+ * @param total The number of samples in the Tree.
+ * @return The latency at the percentile.
+*/
+static TreeData scanPercentile(double p, Tree* pTree, long long total){
+    double position = p / 100.0 * total;
+    long long need = (long long) position;
+    if (need < position)
+        need++;
+    if (need < 1)
+        need = 1;
+
+    long long seen = 0;
+    TreeData result = 0;
+    TreeIterator* pIter = createTreeIterator(pTree);
+    while (hasNext(pIter)){
+        Node* pNode = nextNode(pIter);
+        seen += pNode->count;
+        result = *(pNode->data);
+        if (seen >= need)
+            break;
+    }
+    deleteTreeIterator(pIter);
+    return result;
+}
+
+int main(int argc, char* argv[]){
+    int n = argc > 1 ? atoi(argv[1]) : SAMPLES;
+    int* pSamples = (int*) malloc((size_t) n * sizeof(int));
+    if (n < 1 || pSamples == NULL)
+        OutofStorage();
+
+    /* Latencies in microseconds with a long tail: most samples are a few
+       hundred, one in a hundred is up to a thousand times slower. */
+    benchFillRandom(pSamples, n);
+    for (int i = 0; i < n; i++){
+        unsigned int r = (unsigned int) pSamples[i];
+        pSamples[i] = 100 + (int) (r % 400);
+        if (r % 100 == 0)
+            pSamples[i] += (int) (r / 100 % 400000);
+    }
+
+    Tree* pTree = createBalancedTree();
+    long long start = benchNow();
+    for (int i = 0; i < n; i++)
+        insert(&pSamples[i], pTree);
+    benchReport("insert", n, benchNow() - start);
+    printf("%d samples, %lld in the Tree\n", n, getTotalCount(pTree));
+
+    int quantileCount = (int) (sizeof(quantiles) / sizeof(quantiles[0]));
+    bool ok = getTotalCount(pTree) == n;
+    for (int q = 0; q < quantileCount; q++){
+        TreeData expected = scanPercentile(quantiles[q], pTree, n);
+        TreeData found = *(percentile(quantiles[q], pTree)->data);
+        printf("p%-5g %d us\n", quantiles[q], found);
+        ok = ok && found == expected;
+    }
+
+    /* The scan is slow, so only the first hundredth of the queries runs it. */
+    int scans = QUERIES / 100;
+    long long scanned = 0, selected = 0;
+    start = benchNow();
+    for (int i = 0; i < scans; i++)
+        scanned += scanPercentile(quantiles[i % quantileCount], pTree, n);
+    benchReport("in order scan quantile", scans, benchNow() - start);
+
+    start = benchNow();
+    for (int i = 0; i < QUERIES; i++){
+        TreeData latency = *(percentile(quantiles[i % quantileCount], pTree)->data);
+        if (i < scans)
+            selected += latency;
+    }
+    benchReport("percentile", QUERIES, benchNow() - start);
+    ok = ok && scanned == selected;
+
+    start = benchNow();
+    long long ranks = 0;
+    for (int i = 0; i < QUERIES; i++)
+        ranks += getRank(&pSamples[i], pTree);
+    benchReport("getRank", QUERIES, benchNow() - start);
+    printf("average rank %.0f\n", (double) ranks / QUERIES);
+
+    destroyTree(pTree);
+    free(pSamples);
+    if (!ok){
+        fprintf(stderr, "percentile does not match the in order scan\n");
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * Shows what the operation statistics report for a healthy and for a
+ * degenerate Tree. The balanced Tree keeps its insert and find walks near
+ * log2(n), while the plain Tree fed with sorted keys walks half of its
+ * Nodes on every call. Every other key is inserted twice, so the
+ * duplicate rate of insert is one third.
+ * Usage: bench_tree_stats [keys]
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#ifndef COLLECT_STATS
+#define COLLECT_STATS
+#endif
+#include "bench.h"
+#define TREE_NO_MAIN
+#include "../Tree.c"
+
+#define KEYS 20000
+
+/**
+ * Inserts the keys, every even key twice, looks each one up and erases
+ * half of them, then prints the statistics of the run.
+ *
+ * @param name The name of the run.
+ * @param pTree An empty Tree.
+ * @param pKeys The keys.
+ * @param n The number of keys.
+ * @return false if the statistics do not match the run.
+*/
+static bool run(const char* name, Tree* pTree, int* pKeys, int n){
+    resetStats();
+    long long inserts = 0;
+    for (int i = 0; i < n; i++){
+        insert(&pKeys[i], pTree);
+        inserts++;
+        if (i % 2 == 0){
+            insert(&pKeys[i], pTree);
+            inserts++;
+        }
+    }
+    for (int i = 0; i < n; i++)
+        find(&pKeys[i], pTree);
+    for (int i = 0; i < n; i += 2)
+        erase(&pKeys[i], pTree);
+
+    printf("== %s, height %d\n", name, getHeight(pTree));
+    dumpStats(stdout);
+    destroyTree(pTree);
+
+    OperationStats inserted = getStats(eStatsTreeInsert);
+    OperationStats found = getStats(eStatsTreeFind);
+    return inserted.calls == inserts && inserted.hits >= (n + 1) / 2
+           && found.calls == n && found.hits == n;
+}
+
+int main(int argc, char* argv[]){
+    int n = argc > 1 ? atoi(argv[1]) : KEYS;
+    int* pKeys = (int*) malloc((size_t) n * sizeof(int));
+    if (pKeys == NULL)
+        OutofStorage();
+    for (int i = 0; i < n; i++)
+        pKeys[i] = i;
+
+    bool ok = run("balanced Tree, sorted keys", createBalancedTree(), pKeys, n)
+              && run("plain Tree, sorted keys", createTree(), pKeys, n);
+    benchFillRandom(pKeys, n);
+    ok = ok && run("plain Tree, random keys", createTree(), pKeys, n);
+
+    free(pKeys);
+    if (!ok){
+        fprintf(stderr, "The statistics do not match the operations that ran\n");
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+/**
+ * Compares a full scan and sum of the one value per Node LinkedList with
+ * the UnrolledList.
+ * @author Pasindu Ravimal
+ * @version 1.0
+ * @date 10/18/2026
+*/
+#include "bench.h"
+#define LINKEDLIST_NO_MAIN
+#include "../SinglyLinkedList.c"
+#define UNROLLED_NO_MAIN
+#include "../UnrolledLinkedList.c"
+
+#define SCANS 5
+
+int main(){
+    for (int n = 1000000; n <= 10000000; n *= 10){
+        int* values = (int*) malloc(n * sizeof(int));
+        ListNode** nodes = (ListNode**) malloc(n * sizeof(ListNode*));
+        benchFillRandom(values, n);
+
+        /* A long lived list is scattered over the heap, so link the Nodes
+           in a shuffled allocation order. */
+        LinkedList* pList = createLinkedList();
+        for (int i = 0; i < n; i++)
+            nodes[i] = createListNode(pList, values[i]);
+        for (int i = n - 1; i > 0; i--){
+            int j = (int) ((values[i] & 0x7fffffff) % (i + 1));
+            ListNode* pTemp = nodes[i];
+            nodes[i] = nodes[j];
+            nodes[j] = pTemp;
+        }
+        for (int i = 0; i < n; i++)
+            insertNodetoBack(pList, nodes[i]);
+
+        UnrolledList* pUnrolled = createUnrolledList();
+        for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext)
+            insertUnrolledBack(pUnrolled, *getData(pNode));
+
+        long long sum = 0;
+        long long start = benchNow();
+        for (int s = 0; s < SCANS; s++)
+            for (ListNode* pNode = getFirstNode(pList); pNode != NULL; pNode = pNode->pNext)
+                sum += *getData(pNode);
+        benchReport("LinkedList scan", (long long) SCANS * n, benchNow() - start);
+
+        long long unrolledSum = 0;
+        start = benchNow();
+        for (int s = 0; s < SCANS; s++)
+            for (UnrolledNode* pNode = pUnrolled->pFirstNode; pNode != NULL; pNode = pNode->pNext)
+                for (int i = 0; i < pNode->count; i++)
+                    unrolledSum += pNode->items[i];
+        benchReport("UnrolledList scan", (long long) SCANS * n, benchNow() - start);
+
+        if (sum != unrolledSum){
+            fprintf(stderr, "UnrolledList sum differs from LinkedList sum\n");
+            return EXIT_FAILURE;
+        }
+
+        destroyLinkedList(pList);
+        destroyUnrolledList(pUnrolled);
+        free(nodes);
+        free(values);
+    }
+    return 0;
+}
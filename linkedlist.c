@@ -1,4 +1,6 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include "TrackedAlloc.h"
 
 struct Node{
     int data;
@@ -7,20 +9,40 @@ struct Node{
 
 struct Node head;
 
+/**
+ * Allocates a Node on the heap, so it stays valid after the scope that
+ * created it ends.
+ *
+ * @param data The data to be stored.
+ * @return A pointer to the new Node.
+*/
+struct Node* newNode(int data){
+    struct Node* temp = (struct Node*) trackedMalloc(sizeof(struct Node));
+    if (temp == NULL){
+        fprintf(stderr, "### FATAL RUNTIME ERROR ###"
+        "\n--- No Memory Available --- \n");
+        exit(EXIT_FAILURE);
+    }
+    temp->data = data;
+    temp->next = NULL;
+    return temp;
+}
+
 int main(){
+    AllocStats before = getAllocStats();
     head.data = 0;
     head.next = NULL;
 
-    struct Node temp = {1, NULL};
+    struct Node* temp = newNode(1);
 
-    head.next = &temp;
+    head.next = temp;
 
-    struct Node temp2 = {2,NULL};
+    struct Node* temp2 = newNode(2);
 
-    temp.next = &temp2;
+    temp->next = temp2;
 
     for(int i = 0; i < 2; i++){
-        struct Node temp3 = {i, NULL};
+        struct Node* temp3 = newNode(i);
 
         struct Node* current = &head;
 
@@ -28,7 +50,22 @@ int main(){
             current = current->next;
         }
 
-        current->next = &temp3;
+        current->next = temp3;
+    }
+
+    for (struct Node* current = head.next; current != NULL; current = current->next)
+        printf("%d ", current->data);
+    printf("\n");
+
+    struct Node* current = head.next;
+    while (current != NULL){
+        struct Node* next = current->next;
+        trackedFree(current);
+        current = next;
     }
+    head.next = NULL;
 
+    if (!checkNoLeaks(stderr, "linkedlist demo", &before))
+        return EXIT_FAILURE;
+    return 0;
 }
\ No newline at end of file